@@ -0,0 +1,249 @@
+/*  bench/bench_fixo.c
+    Precisão e tempo do backend de ponto fixo (src/fixo.c) contra double e
+    float, no PC. Viga: modelos aleatórios (biapoiada, balanço, com balanço),
+    V/M em 400 pontos; erro relativo ao maior |V| / |M| do modelo.
+    Seção: a mesma ideia (cotas inteiras, somas exatas em 64 bits) só
+    comporta 14 bits por cota por causa de w*h^3; o erro medido aqui é o
+    motivo de centroid.c continuar em float.
+    Os tempos no PC só comparam os caminhos entre si e não dizem nada do
+    eZ80; lá ainda falta medir ciclos (CEmu).
+
+    Autor: https://github.com/daniSoares08
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+
+#include "fixo.h"
+#include "secao.h"
+
+#define N_MODELOS 2000
+#define N_PONTOS  400
+
+/* referência: mesmas equações de viga.c (resolver_reacoes +
+   calcular_forcas_internas_em), em double e em float */
+#define REFERENCIA(T, NOME)                                                      \
+static void NOME##_reacoes(const FxModelo *m, T *R, T *Ma) {                     \
+    T pa = (T)m->ap_pos[0], sf = 0, sm = 0;                                      \
+    for (int i = 0; i < m->np; i++) {                                            \
+        sf += (T)m->p_F[i]; sm += (T)m->p_F[i] * ((T)m->p_pos[i] - pa);          \
+    }                                                                            \
+    for (int i = 0; i < m->nd; i++) {                                            \
+        T a = (T)m->d_a[i], Ld = (T)m->d_b[i] - a;                               \
+        T qa = (T)m->d_qa[i], qb = (T)m->d_qb[i];                                \
+        T F = (qa + qb) / 2 * Ld;                                                \
+        sf += F;                                                                 \
+        sm += F * (a - pa) + Ld * Ld * (qa + 2*qb) / 6;                          \
+    }                                                                            \
+    for (int i = 0; i < m->nm; i++) sm += (T)m->m_val[i];                        \
+    if (m->na == 1) { R[0] = sf; Ma[0] = -sm; return; }                          \
+    R[1] = sm / ((T)m->ap_pos[1] - pa); R[0] = sf - R[1];                        \
+    Ma[0] = Ma[1] = 0;                                                           \
+}                                                                                \
+static void NOME##_VM(const FxModelo *m, const T *R, const T *Ma, T x,           \
+                      T *pV, T *pM) {                                            \
+    T V = 0, M = 0;                                                              \
+    for (int i = 0; i < m->na; i++)                                              \
+        if ((T)m->ap_pos[i] < x) { V += R[i]; M += R[i]*(x-(T)m->ap_pos[i]) + Ma[i]; } \
+    for (int i = 0; i < m->np; i++)                                              \
+        if ((T)m->p_pos[i] <= x) { V -= (T)m->p_F[i]; M -= (T)m->p_F[i]*(x-(T)m->p_pos[i]); } \
+    for (int i = 0; i < m->nd; i++) {                                            \
+        T a = (T)m->d_a[i], b = (T)m->d_b[i], qa = (T)m->d_qa[i], qb = (T)m->d_qb[i]; \
+        if (x <= a) continue;                                                    \
+        T Ld = b - a, k = (qb - qa) / Ld;                                        \
+        if (x <= b) {                                                            \
+            T dx = x - a;                                                        \
+            V -= qa*dx + k*dx*dx/2;                                              \
+            M -= qa*dx*dx/2 + k*dx*dx*dx/6;                                      \
+        } else {                                                                 \
+            T F = qa*Ld + k*Ld*Ld/2;                                             \
+            V -= F;                                                              \
+            M -= (x - a)*F - (qa*Ld*Ld/2 + k*Ld*Ld*Ld/3);                        \
+        }                                                                        \
+    }                                                                            \
+    for (int i = 0; i < m->nm; i++) if ((T)m->m_pos[i] <= x) M += (T)m->m_val[i]; \
+    *pV = V; *pM = M;                                                            \
+}
+
+REFERENCIA(double, ref_d)
+REFERENCIA(float,  ref_f)
+
+static double sorteio(double a, double b) {
+    return a + (b - a) * (double)rand() / (double)RAND_MAX;
+}
+
+static void modelo_aleatorio(FxModelo *m) {
+    double L = pow(10.0, sorteio(-1.0, 1.5));        /* 0.1 .. 30 m      */
+    double F = pow(10.0, sorteio(1.0, 6.0));         /* 10 N .. 1 MN     */
+    m->L = L;
+    int tipo = rand() % 3;
+    m->engaste = (tipo == 0);
+    m->na = m->engaste ? 1 : 2;
+    m->ap_pos[0] = 0.0;
+    m->ap_pos[1] = (tipo == 1) ? L : sorteio(0.5, 0.9) * L;
+    m->np = rand() % (FX_MAX_P + 1);
+    for (int i = 0; i < m->np; i++) {
+        m->p_pos[i] = sorteio(0.0, L);
+        m->p_F[i] = sorteio(-F, F);
+    }
+    m->nd = rand() % (FX_MAX_D + 1);
+    for (int i = 0; i < m->nd; i++) {
+        double a = sorteio(0.0, L), b = sorteio(0.0, L);
+        if (b < a) { double t = a; a = b; b = t; }
+        if (b - a < 1e-3 * L) b = a + 1e-3 * L;
+        m->d_a[i] = a; m->d_b[i] = b;
+        m->d_qa[i] = sorteio(-F, F) / L;
+        m->d_qb[i] = sorteio(-F, F) / L;
+    }
+    m->nm = rand() % 3;
+    for (int i = 0; i < m->nm; i++) {
+        m->m_pos[i] = sorteio(0.0, L);
+        m->m_val[i] = sorteio(-F, F) * L;
+    }
+}
+
+/* perto de um evento V (e M, com momento aplicado) salta: lados diferentes
+   da descontinuidade não contam como erro */
+static bool perto_evento(const FxModelo *m, double x) {
+    double e = 1e-5 * m->L;
+    for (int i = 0; i < m->na; i++) if (fabs(x - m->ap_pos[i]) < e) return true;
+    for (int i = 0; i < m->np; i++) if (fabs(x - m->p_pos[i]) < e) return true;
+    for (int i = 0; i < m->nm; i++) if (fabs(x - m->m_pos[i]) < e) return true;
+    return false;
+}
+
+static double agora(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + 1e-9 * t.tv_nsec;
+}
+
+static void bench_viga(void) {
+    static FxModelo ms[N_MODELOS];
+    static FxViga   fv[N_MODELOS];
+    static double   Rd[N_MODELOS][2], Mad[N_MODELOS][2];
+    static float    Rf[N_MODELOS][2], Maf[N_MODELOS][2];
+    double eV_fx = 0, eM_fx = 0, eV_f = 0, eM_f = 0;
+    volatile double soma = 0.0;
+
+    for (int k = 0; k < N_MODELOS; k++) {
+        modelo_aleatorio(&ms[k]);
+        ref_d_reacoes(&ms[k], Rd[k], Mad[k]);
+        ref_f_reacoes(&ms[k], Rf[k], Maf[k]);
+        if (!fixo_viga_montar(&ms[k], &fv[k])) { printf("montar falhou no modelo %d\n", k); return; }
+    }
+
+    /* precisão */
+    for (int k = 0; k < N_MODELOS; k++) {
+        double L = ms[k].L, Vs = 0, Ms = 0, dV = 0, dM = 0, dVf = 0, dMf = 0;
+        for (int i = 0; i <= N_PONTOS; i++) {
+            double x = L * i / N_PONTOS, V, M, Vx, Mx;
+            float Vf, Mf;
+            ref_d_VM(&ms[k], Rd[k], Mad[k], x, &V, &M);
+            ref_f_VM(&ms[k], Rf[k], Maf[k], (float)x, &Vf, &Mf);
+            fixo_viga_VM(&fv[k], x, &Vx, &Mx);
+            if (perto_evento(&ms[k], x)) continue;
+            Vs = fmax(Vs, fabs(V)); Ms = fmax(Ms, fabs(M));
+            dV = fmax(dV, fabs(Vx - V)); dM = fmax(dM, fabs(Mx - M));
+            dVf = fmax(dVf, fabs(Vf - V)); dMf = fmax(dMf, fabs(Mf - M));
+        }
+        if (Vs > 0) { eV_fx = fmax(eV_fx, dV / Vs); eV_f = fmax(eV_f, dVf / Vs); }
+        if (Ms > 0) { eM_fx = fmax(eM_fx, dM / Ms); eM_f = fmax(eM_f, dMf / Ms); }
+    }
+    printf("viga: %d modelos x %d pontos, erro max relativo a max|.|\n", N_MODELOS, N_PONTOS + 1);
+    printf("  fixo : V %.2e  M %.2e\n", eV_fx, eM_fx);
+    printf("  float: V %.2e  M %.2e\n", eV_f, eM_f);
+
+    /* tempo por avaliação V/M */
+    double t0 = agora();
+    for (int k = 0; k < N_MODELOS; k++)
+        for (int i = 0; i <= N_PONTOS; i++) {
+            double V, M;
+            ref_d_VM(&ms[k], Rd[k], Mad[k], ms[k].L * i / N_PONTOS, &V, &M);
+            soma += M;
+        }
+    double t1 = agora();
+    for (int k = 0; k < N_MODELOS; k++)
+        for (int i = 0; i <= N_PONTOS; i++) {
+            float V, M;
+            ref_f_VM(&ms[k], Rf[k], Maf[k], (float)(ms[k].L * i / N_PONTOS), &V, &M);
+            soma += M;
+        }
+    double t2 = agora();
+    for (int k = 0; k < N_MODELOS; k++)
+        for (int i = 0; i <= N_PONTOS; i++) {
+            double V, M;
+            fixo_viga_VM(&fv[k], ms[k].L * i / N_PONTOS, &V, &M);
+            soma += M;
+        }
+    double t3 = agora();
+    double n = (double)N_MODELOS * (N_PONTOS + 1);
+    printf("  ns/ponto: double %.1f  float %.1f  fixo %.1f\n",
+           1e9 * (t1 - t0) / n, 1e9 * (t2 - t1) / n, 1e9 * (t3 - t2) / n);
+}
+
+/* A, Sy, Ixx da soma com sinal em inteiros: cota < 2^14 para w*(y1^3 - y0^3)
+   de 8 retângulos caber em 64 bits */
+static void secao_fixo(const Rect *r, int n, double *pA, double *pSy, double *pIxx) {
+    double cm = 0.0;
+    for (int i = 0; i < n; i++) {
+        cm = fmax(cm, fmax(fabs(r[i].x0 + r[i].w), fabs(r[i].y0 + r[i].h)));
+        cm = fmax(cm, fmax(fabs(r[i].x0), fabs(r[i].y0)));
+    }
+    int e;
+    frexp(cm, &e);
+    e -= 14;
+    int64_t A = 0, Sy2 = 0, Ixx3 = 0;
+    for (int i = 0; i < n; i++) {
+        int64_t x0 = llround(ldexp(r[i].x0, -e)), x1 = llround(ldexp(r[i].x0 + r[i].w, -e));
+        int64_t y0 = llround(ldexp(r[i].y0, -e)), y1 = llround(ldexp(r[i].y0 + r[i].h, -e));
+        int64_t s = r[i].rec ? -1 : 1;
+        A    += s * (x1 - x0) * (y1 - y0);
+        Sy2  += s * (x1 - x0) * (y1*y1 - y0*y0);
+        Ixx3 += s * (x1 - x0) * (y1*y1*y1 - y0*y0*y0);
+    }
+    *pA   = ldexp((double)A, 2*e);
+    *pSy  = ldexp((double)Sy2, 3*e) / 2.0;
+    *pIxx = ldexp((double)Ixx3, 4*e) / 3.0;
+}
+
+static void bench_secao(void) {
+    double eA = 0, eS = 0, eI = 0;
+    for (int k = 0; k < N_MODELOS; k++) {
+        Rect r[8];
+        int n = 1 + rand() % 8;
+        double esc = pow(10.0, sorteio(-3.0, 0.0));
+        /* cotas "de projeto": múltiplos de 0.5 mm numa peça de até 1 m */
+        for (int i = 0; i < n; i++) {
+            r[i].rec = (i > 0 && rand() % 4 == 0);
+            r[i].w  = esc * (1 + rand() % 400) / 400.0;
+            r[i].h  = esc * (1 + rand() % 400) / 400.0;
+            r[i].x0 = esc * (rand() % 400) / 400.0;
+            r[i].y0 = esc * (rand() % 400) / 400.0;
+        }
+        double fA, fSy, fIxx;
+        secao_fixo(r, n, &fA, &fSy, &fIxx);
+
+        double A = 0, Sy = 0, Ixx = 0;
+        for (int i = 0; i < n; i++) {
+            double s = r[i].rec ? -1.0 : 1.0, a = s * r[i].w * r[i].h, cy = r[i].y0 + r[i].h / 2;
+            A += a; Sy += a * cy;
+            Ixx += s * r[i].w * r[i].h * r[i].h * r[i].h / 12.0 + a * cy * cy;
+        }
+        double escA = esc * esc, escS = escA * esc, escI = escS * esc;
+        eA = fmax(eA, fabs(fA - A) / escA);
+        eS = fmax(eS, fabs(fSy - Sy) / escS);
+        eI = fmax(eI, fabs(fIxx - Ixx) / escI);
+    }
+    printf("secao (cotas de 14 bits): %d figuras, erro max relativo a tamanho^k\n", N_MODELOS);
+    printf("  A %.2e  Sy %.2e  Ixx %.2e\n", eA, eS, eI);
+}
+
+int main(void) {
+    srand(12345);
+    bench_viga();
+    bench_secao();
+    return 0;
+}
@@ -0,0 +1,127 @@
+/*  bench/bench_real.c
+    Precisão e tempo de cada real_t (src/real.h) nos núcleos que rodam sem
+    tela: beam.c (flecha, forma fechada) e uniao.c (momentos da união).
+    O mesmo arquivo é compilado uma vez por precisão; a referência é
+    long double. make precisao roda todas e imprime lado a lado.
+
+    Autor: https://github.com/daniSoares08
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "real.h"
+#include "beam.h"
+#include "secao.h"
+
+#define N_CASOS  2000
+#define N_PONTOS 200
+
+typedef long double ref_t;
+
+static ref_t sorteio(ref_t a, ref_t b) {
+    return a + (b - a) * (ref_t)rand() / (ref_t)RAND_MAX;
+}
+
+static ref_t absl(ref_t v) { return v < 0 ? -v : v; }
+
+static double agora(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + 1e-9 * t.tv_nsec;
+}
+
+/* y(x) da biapoiada com carga pontual, mesmas fórmulas de beam_solve/y_of */
+static ref_t flecha_ref(ref_t L, ref_t EI, ref_t P, ref_t a, ref_t x) {
+    ref_t RA = P * (L - a) / L;
+    ref_t C = -(RA*L*L*L - P*(L - a)*(L - a)*(L - a)) / (6 * EI * L);
+    ref_t y = RA*x*x*x / (6 * EI) + C*x;
+    if (x >= a) y -= P*(x - a)*(x - a)*(x - a) / (6 * EI);
+    return y;
+}
+
+static void bench_beam(void) {
+    static Beam bs[N_CASOS];
+    static ref_t par[N_CASOS][4];
+    ref_t emax = 0;
+    volatile real_t soma = 0;
+
+    for (int k = 0; k < N_CASOS; k++) {
+        ref_t L = sorteio(0.5L, 20.0L), EI = sorteio(1e4L, 1e8L);
+        ref_t P = sorteio(1e2L, 1e6L), a = sorteio(0.05L, 0.95L) * L;
+        par[k][0] = L; par[k][1] = EI; par[k][2] = P; par[k][3] = a;
+        beam_init(&bs[k], (real_t)L, (real_t)EI, (real_t)P, (real_t)a);
+    }
+    for (int k = 0; k < N_CASOS; k++) {
+        ref_t ymax = 0, dmax = 0;
+        for (int i = 0; i <= N_PONTOS; i++) {
+            ref_t x = par[k][0] * i / N_PONTOS;
+            ref_t y = flecha_ref(par[k][0], par[k][1], par[k][2], par[k][3], x);
+            real_t yr = y_of(&bs[k], (real_t)x);
+            if (absl(y) > ymax) ymax = absl(y);
+            if (absl(yr - y) > dmax) dmax = absl(yr - y);
+        }
+        if (ymax > 0 && dmax / ymax > emax) emax = dmax / ymax;
+    }
+
+    double t0 = agora();
+    for (int k = 0; k < N_CASOS; k++)
+        for (int i = 0; i <= N_PONTOS; i++)
+            soma += y_of(&bs[k], bs[k].L * i / N_PONTOS);
+    double t1 = agora();
+    printf("  beam y(x):  erro max %.2e   %.1f ns/ponto\n",
+           (double)emax, 1e9 * (t1 - t0) / ((double)N_CASOS * (N_PONTOS + 1)));
+}
+
+static void bench_uniao(void) {
+    static Rect rs[N_CASOS][6];
+    static int  ns[N_CASOS];
+    ref_t eA = 0, eI = 0;
+    volatile real_t soma = 0;
+
+    /* perfis em I (mesa, alma, mesa) + chapas soltas ao lado: sem sobreposição,
+       então a referência é a soma simples */
+    for (int k = 0; k < N_CASOS; k++) {
+        ref_t esc = sorteio(0.01L, 1.0L);
+        ref_t bf = esc * sorteio(0.3L, 1.0L), tf = esc * sorteio(0.02L, 0.08L);
+        ref_t d = esc, tw = esc * sorteio(0.01L, 0.05L);
+        Rect *r = rs[k];
+        r[0] = (Rect){ 0, (real_t)bf, (real_t)tf, 0, 0 };
+        r[1] = (Rect){ 0, (real_t)tw, (real_t)(d - 2*tf), (real_t)((bf - tw) / 2), (real_t)tf };
+        r[2] = (Rect){ 0, (real_t)bf, (real_t)tf, 0, (real_t)(d - tf) };
+        ns[k] = 3 + rand() % 4;
+        for (int i = 3; i < ns[k]; i++)
+            r[i] = (Rect){ 0, (real_t)(esc * 0.1L), (real_t)(esc * 0.2L),
+                           (real_t)(bf + esc * 0.2L * i), (real_t)(esc * 0.1L * i) };
+
+        ref_t A = 0, Ixx = 0;
+        for (int i = 0; i < ns[k]; i++) {
+            ref_t w = r[i].w, h = r[i].h, y0 = r[i].y0;
+            A   += w * h;
+            Ixx += w * ((y0 + h)*(y0 + h)*(y0 + h) - y0*y0*y0) / 3;
+        }
+        SecMomentos m;
+        uniao_momentos(r, ns[k], &m);
+        if (absl(m.A - A) / A > eA) eA = absl(m.A - A) / A;
+        if (absl(m.Ixx - Ixx) / Ixx > eI) eI = absl(m.Ixx - Ixx) / Ixx;
+    }
+
+    double t0 = agora();
+    for (int k = 0; k < N_CASOS; k++) {
+        SecMomentos m;
+        uniao_momentos(rs[k], ns[k], &m);
+        soma += m.Ixx;
+    }
+    double t1 = agora();
+    printf("  uniao A/Ixx: erro max %.2e / %.2e   %.0f ns/figura\n",
+           (double)eA, (double)eI, 1e9 * (t1 - t0) / N_CASOS);
+}
+
+int main(void) {
+    srand(4321);
+    printf("real_t = %s (%d bytes)\n", REAL_NOME, (int)sizeof(real_t));
+    bench_beam();
+    bench_uniao();
+    return 0;
+}
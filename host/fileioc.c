@@ -0,0 +1,83 @@
+/*  host/fileioc.c
+    Substituto do fileioc (CEdev) para rodar MECSOL no PC
+    AppVar = arquivo em MECSOL_APPVARS (padrão "appvars"), só leitura.
+
+    Autor: https://github.com/daniSoares08
+*/
+
+#define _DEFAULT_SOURCE
+
+#include <dirent.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "fileioc.h"
+
+#define MAX_ABERTOS 5
+
+static FILE *abertos[MAX_ABERTOS];
+
+static const char *diretorio(void) {
+    const char *d = getenv("MECSOL_APPVARS");
+    return (d && *d) ? d : "appvars";
+}
+
+uint8_t ti_Open(const char *name, const char *mode) {
+    char caminho[512];
+    if (mode[0] != 'r') return 0;
+    snprintf(caminho, sizeof caminho, "%s/%s", diretorio(), name);
+    for (int i = 0; i < MAX_ABERTOS; i++) {
+        if (abertos[i]) continue;
+        abertos[i] = fopen(caminho, "rb");
+        return abertos[i] ? (uint8_t)(i + 1) : 0;
+    }
+    return 0;
+}
+
+int ti_Close(uint8_t handle) {
+    if (handle < 1 || handle > MAX_ABERTOS || !abertos[handle - 1]) return 0;
+    fclose(abertos[handle - 1]);
+    abertos[handle - 1] = NULL;
+    return 1;
+}
+
+int ti_GetC(uint8_t handle) {
+    if (handle < 1 || handle > MAX_ABERTOS || !abertos[handle - 1]) return EOF;
+    return fgetc(abertos[handle - 1]);
+}
+
+size_t ti_Read(void *data, size_t size, size_t count, uint8_t handle) {
+    if (handle < 1 || handle > MAX_ABERTOS || !abertos[handle - 1]) return 0;
+    return fread(data, size, count, abertos[handle - 1]);
+}
+
+/* *pos guarda o índice (1-based) da próxima entrada em ordem alfabética */
+char *ti_Detect(void **curr_search_posistion, const char *detection_string) {
+    static char nome[9];
+    struct dirent **lista;
+    int n = scandir(diretorio(), &lista, NULL, alphasort);
+    if (n < 0) return NULL;
+
+    char *achou = NULL;
+    size_t lm = strlen(detection_string);
+    for (intptr_t i = (intptr_t)*curr_search_posistion; i < n && !achou; i++) {
+        const char *e = lista[i]->d_name;
+        if (e[0] == '.' || strlen(e) > 8) continue;
+        char caminho[512], ini[16] = { 0 };
+        snprintf(caminho, sizeof caminho, "%s/%s", diretorio(), e);
+        FILE *f = fopen(caminho, "rb");
+        if (!f) continue;
+        size_t lidos = fread(ini, 1, lm < sizeof ini ? lm : sizeof ini, f);
+        fclose(f);
+        if (lidos == lm && memcmp(ini, detection_string, lm) == 0) {
+            snprintf(nome, sizeof nome, "%s", e);
+            achou = nome;
+            *curr_search_posistion = (void *)(i + 1);
+        }
+    }
+    for (int i = 0; i < n; i++) free(lista[i]);
+    free(lista);
+    return achou;
+}
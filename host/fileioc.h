@@ -0,0 +1,22 @@
+/*  host/fileioc.h
+    Substituto do fileioc (CEdev) para rodar MECSOL no PC
+    AppVars são arquivos comuns num diretório (MECSOL_APPVARS, padrão
+    "appvars"); o nome do arquivo é o nome da AppVar. Só leitura.
+
+    Autor: https://github.com/daniSoares08
+*/
+
+#ifndef HOST_FILEIOC_H
+#define HOST_FILEIOC_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>   /* EOF */
+
+uint8_t ti_Open(const char *name, const char *mode);
+int     ti_Close(uint8_t handle);
+int     ti_GetC(uint8_t handle);
+size_t  ti_Read(void *data, size_t size, size_t count, uint8_t handle);
+char   *ti_Detect(void **curr_search_posistion, const char *detection_string);
+
+#endif
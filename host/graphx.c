@@ -0,0 +1,343 @@
+/*  host/graphx.c
+    Substituto do graphx (CEdev) para rodar MECSOL no PC
+    Dois buffers 320x240 de índices de paleta, como a VRAM do CE: um no LCD
+    e outro de trás. Todo desenho passa por px_*, que recorta na tela e
+    conta os pixels; swap/blit contam o que chega ao LCD (host.h).
+
+    Autor: https://github.com/daniSoares08
+*/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "graphx.h"
+#include "host.h"
+#include "fonte8x8.h"
+
+#define W GFX_LCD_WIDTH
+#define H GFX_LCD_HEIGHT
+
+uint16_t gfx_palette[256];
+
+static uint8_t fb[2][H][W];
+static int     vis = 0;              /* buffer no LCD                     */
+static bool    no_buffer = false;    /* desenhando no de trás?            */
+static uint8_t cor = 0;
+static uint8_t txt_fg = 0, txt_bg = 255, txt_tr = 0;
+static uint8_t txt_sx = 1, txt_sy = 1;
+static unsigned long px_antes;       /* pixels no início da chamada atual */
+
+#define ALVO (fb[no_buffer ? !vis : vis])
+
+const uint8_t *host_lcd(void) { return &fb[vis][0][0]; }
+
+/* ======== contagem ======== */
+
+static void inicio(void) {
+    host_q.chamadas++;
+    px_antes = host_q.pixels;
+}
+
+/* desenho direto na tela aparece na hora */
+static void fim(void) {
+    if (!no_buffer && host_q.pixels != px_antes) host_apresentou(host_q.pixels - px_antes);
+}
+
+static inline void px_por(int x, int y, uint8_t c) {
+    if ((unsigned)x >= W || (unsigned)y >= H) return;
+    ALVO[y][x] = c;
+    host_q.pixels++;
+}
+
+static void px_linha_h(int x, int y, int n, uint8_t c) {
+    if ((unsigned)y >= H) return;
+    if (x < 0) { n += x; x = 0; }
+    if (x + n > W) n = W - x;
+    if (n <= 0) return;
+    memset(&ALVO[y][x], c, (size_t)n);
+    host_q.pixels += (unsigned long)n;
+}
+
+/* ======== início / buffers ======== */
+
+void gfx_Begin(void) {
+    for (int i = 0; i < 256; i++) gfx_palette[i] = gfx_RGBTo1555(i, i, i);
+    memset(fb, 255, sizeof fb);
+    vis = 0;
+    no_buffer = false;
+    cor = 0;
+    txt_fg = 0; txt_bg = 255; txt_tr = 0;
+    host_iniciar();
+    txt_sx = txt_sy = 1;
+}
+
+void gfx_End(void) {
+}
+
+void gfx_SetDraw(uint8_t location) {
+    no_buffer = (location == gfx_buffer);
+}
+
+void gfx_SwapDraw(void) {
+    vis = !vis;
+    host_apresentou((unsigned long)W * H);
+}
+
+/* copia src para o outro buffer */
+void gfx_Blit(gfx_location_t src) {
+    int s = (src == gfx_buffer) ? !vis : vis;
+    memcpy(fb[!s], fb[s], sizeof fb[0]);
+    if (src == gfx_buffer) host_apresentou((unsigned long)W * H);
+}
+
+void gfx_BlitRectangle(gfx_location_t src, unsigned x, uint8_t y, unsigned width, unsigned height) {
+    int s = (src == gfx_buffer) ? !vis : vis;
+    if (x >= W || y >= H) return;
+    if (x + width > W)  width = W - x;
+    if (y + height > H) height = H - y;
+    for (unsigned j = 0; j < height; j++)
+        memcpy(&fb[!s][y + j][x], &fb[s][y + j][x], width);
+    if (src == gfx_buffer) host_apresentou((unsigned long)width * height);
+}
+
+/* ======== primitivas ======== */
+
+uint8_t gfx_SetColor(uint8_t index) {
+    uint8_t antes = cor;
+    cor = index;
+    return antes;
+}
+
+void gfx_FillScreen(uint8_t index) {
+    inicio();
+    memset(ALVO, index, sizeof fb[0]);
+    host_q.pixels += (unsigned long)W * H;
+    host_limpou();
+    fim();
+}
+
+void gfx_SetPixel(unsigned x, uint8_t y) {
+    inicio();
+    px_por((int)x, y, cor);
+    fim();
+}
+
+void gfx_FillRectangle(int x, int y, int width, int height) {
+    inicio();
+    for (int j = 0; j < height; j++) px_linha_h(x, y + j, width, cor);
+    fim();
+}
+
+void gfx_Rectangle(int x, int y, int width, int height) {
+    inicio();
+    if (width > 0 && height > 0) {
+        px_linha_h(x, y, width, cor);
+        px_linha_h(x, y + height - 1, width, cor);
+        for (int j = 1; j < height - 1; j++) {
+            px_por(x, y + j, cor);
+            px_por(x + width - 1, y + j, cor);
+        }
+    }
+    fim();
+}
+
+void gfx_HorizLine(int x, int y, int length) {
+    inicio();
+    px_linha_h(x, y, length, cor);
+    fim();
+}
+
+void gfx_VertLine(int x, int y, int length) {
+    inicio();
+    for (int j = 0; j < length; j++) px_por(x, y + j, cor);
+    fim();
+}
+
+void gfx_Line(int x0, int y0, int x1, int y1) {
+    inicio();
+    int dx = abs(x1 - x0), sx = x0 < x1 ? 1 : -1;
+    int dy = -abs(y1 - y0), sy = y0 < y1 ? 1 : -1;
+    int err = dx + dy;
+    for (;;) {
+        px_por(x0, y0, cor);
+        if (x0 == x1 && y0 == y1) break;
+        int e2 = 2 * err;
+        if (e2 >= dy) { err += dy; x0 += sx; }
+        if (e2 <= dx) { err += dx; y0 += sy; }
+    }
+    fim();
+}
+
+void gfx_Circle(int x, int y, unsigned radius) {
+    inicio();
+    int r = (int)radius, a = r, b = 0, err = 1 - r;
+    while (a >= b) {
+        px_por(x + a, y + b, cor); px_por(x - a, y + b, cor);
+        px_por(x + a, y - b, cor); px_por(x - a, y - b, cor);
+        px_por(x + b, y + a, cor); px_por(x - b, y + a, cor);
+        px_por(x + b, y - a, cor); px_por(x - b, y - a, cor);
+        b++;
+        if (err < 0) err += 2 * b + 1;
+        else { a--; err += 2 * (b - a) + 1; }
+    }
+    fim();
+}
+
+void gfx_FillCircle(int x, int y, unsigned radius) {
+    inicio();
+    int r = (int)radius;
+    for (int j = -r; j <= r; j++) {
+        int a = 0;
+        while ((a + 1) * (a + 1) + j * j <= r * r) a++;
+        px_linha_h(x - a, y + j, 2 * a + 1, cor);
+    }
+    fim();
+}
+
+void gfx_FillTriangle(int x0, int y0, int x1, int y1, int x2, int y2) {
+    inicio();
+    /* ordena por y e varre linha a linha entre as arestas */
+    int t;
+    if (y0 > y1) { t = y0; y0 = y1; y1 = t; t = x0; x0 = x1; x1 = t; }
+    if (y1 > y2) { t = y1; y1 = y2; y2 = t; t = x1; x1 = x2; x2 = t; }
+    if (y0 > y1) { t = y0; y0 = y1; y1 = t; t = x0; x0 = x1; x1 = t; }
+    for (int y = y0; y <= y2; y++) {
+        int xa = (y2 == y0) ? x0 : x0 + (x2 - x0) * (y - y0) / (y2 - y0);
+        int xb;
+        if (y < y1) xb = x0 + (x1 - x0) * (y - y0) / (y1 - y0);
+        else        xb = (y2 == y1) ? x1 : x1 + (x2 - x1) * (y - y1) / (y2 - y1);
+        if (xa > xb) { t = xa; xa = xb; xb = t; }
+        px_linha_h(xa, y, xb - xa + 1, cor);
+    }
+    fim();
+}
+
+/* ======== sprites ======== */
+
+gfx_sprite_t *gfx_GetSprite(gfx_sprite_t *sprite_buffer, int x, int y) {
+    uint8_t *d = sprite_buffer->data;
+    for (int j = 0; j < sprite_buffer->height; j++)
+        for (int i = 0; i < sprite_buffer->width; i++) {
+            int xx = x + i, yy = y + j;
+            *d++ = ((unsigned)xx < W && (unsigned)yy < H) ? ALVO[yy][xx] : 0;
+        }
+    return sprite_buffer;
+}
+
+void gfx_Sprite_NoClip(const gfx_sprite_t *sprite, unsigned x, uint8_t y) {
+    inicio();
+    const uint8_t *s = sprite->data;
+    for (int j = 0; j < sprite->height; j++)
+        for (int i = 0; i < sprite->width; i++) px_por((int)x + i, y + j, *s++);
+    host_q.sprites++;
+    fim();
+}
+
+/* RLET por linha: [transparentes][opacos][pixels opacos]... até a largura;
+   o índice 0 é o transparente (padrão do graphx) */
+static size_t rlet_codificar(const gfx_sprite_t *in, uint8_t *out) {
+    size_t n = 0;
+    const uint8_t *s = in->data;
+    for (int j = 0; j < in->height; j++, s += in->width) {
+        int i = 0;
+        for (;;) {
+            int t = 0;
+            while (i < in->width && s[i] == 0) { i++; t++; }
+            if (out) out[n] = (uint8_t)t;
+            n++;
+            if (i == in->width) break;
+            int o = 0;
+            while (i + o < in->width && s[i + o] != 0) o++;
+            if (out) { out[n] = (uint8_t)o; memcpy(&out[n + 1], &s[i], (size_t)o); }
+            n += 1 + (size_t)o;
+            i += o;
+            if (i == in->width) break;
+        }
+    }
+    return n;
+}
+
+gfx_rletsprite_t *gfx_ConvertToNewRLETSprite(const gfx_sprite_t *sprite_in, void *(*malloc_routine)(size_t)) {
+    size_t n = rlet_codificar(sprite_in, NULL);
+    gfx_rletsprite_t *r = malloc_routine(2 + n);
+    if (!r) return NULL;
+    r->width = sprite_in->width;
+    r->height = sprite_in->height;
+    rlet_codificar(sprite_in, r->data);
+    return r;
+}
+
+void gfx_RLETSprite_NoClip(const gfx_rletsprite_t *sprite, unsigned x, uint8_t y) {
+    inicio();
+    const uint8_t *s = sprite->data;
+    for (int j = 0; j < sprite->height; j++) {
+        int i = 0;
+        for (;;) {
+            i += *s++;
+            if (i >= sprite->width) break;
+            int o = *s++;
+            for (int k = 0; k < o; k++) px_por((int)x + i + k, y + j, *s++);
+            i += o;
+            if (i >= sprite->width) break;
+        }
+    }
+    host_q.sprites++;
+    fim();
+}
+
+/* ======== texto ======== */
+
+uint8_t gfx_SetTextFGColor(uint8_t color) { uint8_t a = txt_fg; txt_fg = color; return a; }
+uint8_t gfx_SetTextBGColor(uint8_t color) { uint8_t a = txt_bg; txt_bg = color; return a; }
+uint8_t gfx_SetTextTransparentColor(uint8_t color) { uint8_t a = txt_tr; txt_tr = color; return a; }
+
+void gfx_SetTextScale(uint8_t width_scale, uint8_t height_scale) {
+    txt_sx = width_scale ? width_scale : 1;
+    txt_sy = height_scale ? height_scale : 1;
+}
+
+static const uint8_t *glifo(char c) {
+    unsigned char u = (unsigned char)c;
+    return fonte8x8[(u >= 0x20 && u <= 0x7E) ? u - 0x20 : '?' - 0x20];
+}
+
+/* colunas ocupadas do glifo: [*pc0, c0 + largura - 1) + 1 px de espaço */
+static int glifo_largura(char c, int *pc0) {
+    const uint8_t *g = glifo(c);
+    uint8_t cols = 0;
+    for (int j = 0; j < 8; j++) cols |= g[j];
+    if (!cols) { *pc0 = 0; return 4; }
+    int c0 = 0, c1 = 7;
+    while (!(cols & (1u << c0))) c0++;
+    while (!(cols & (1u << c1))) c1--;
+    *pc0 = c0;
+    return c1 - c0 + 2;
+}
+
+unsigned gfx_GetStringWidth(const char *string) {
+    unsigned w = 0;
+    int c0;
+    for (; *string; string++) w += (unsigned)glifo_largura(*string, &c0) * txt_sx;
+    return w;
+}
+
+void gfx_PrintStringXY(const char *string, int x, int y) {
+    inicio();
+    host_texto(string);
+    for (; *string; string++) {
+        int c0, lw = glifo_largura(*string, &c0);
+        const uint8_t *g = glifo(*string);
+        for (int j = 0; j < 8 * txt_sy; j++) {
+            uint8_t linha = g[j / txt_sy];
+            for (int i = 0; i < lw * txt_sx; i++) {
+                int bit = c0 + i / txt_sx;
+                bool liga = bit < 8 && (linha & (1u << bit));
+                if (liga) px_por(x + i, y + j, txt_fg);
+                else if (txt_bg != txt_tr) px_por(x + i, y + j, txt_bg);
+            }
+        }
+        host_q.glifos++;
+        x += lw * txt_sx;
+    }
+    fim();
+}
@@ -0,0 +1,65 @@
+/*  host/graphx.h
+    Substituto do graphx (CEdev) para rodar MECSOL no PC - ver host/README.md
+    Só o subconjunto usado em src/. Desenha num framebuffer 320x240 de 8 bits
+    em memória (dois buffers, como o LCD do CE) e conta chamadas e pixels.
+
+    Autor: https://github.com/daniSoares08
+*/
+
+#ifndef HOST_GRAPHX_H
+#define HOST_GRAPHX_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define GFX_LCD_WIDTH  320
+#define GFX_LCD_HEIGHT 240
+
+typedef struct { uint8_t width, height; uint8_t data[]; } gfx_sprite_t;
+typedef struct { uint8_t width, height; uint8_t data[]; } gfx_rletsprite_t;
+
+typedef enum { gfx_screen = 0, gfx_buffer = 1 } gfx_location_t;
+
+extern uint16_t gfx_palette[256];
+
+#define gfx_RGBTo1555(r, g, b) \
+    ((uint16_t)(((uint8_t)(r) >> 3) << 10 | ((uint8_t)(g) >> 3) << 5 | ((uint8_t)(b) >> 3)))
+
+void gfx_Begin(void);
+void gfx_End(void);
+
+void gfx_SetDraw(uint8_t location);
+void gfx_SwapDraw(void);
+void gfx_Blit(gfx_location_t src);
+void gfx_BlitRectangle(gfx_location_t src, unsigned x, uint8_t y, unsigned width, unsigned height);
+#define gfx_SetDrawBuffer() gfx_SetDraw(gfx_buffer)
+#define gfx_SetDrawScreen() gfx_SetDraw(gfx_screen)
+#define gfx_BlitScreen()    gfx_Blit(gfx_screen)
+#define gfx_BlitBuffer()    gfx_Blit(gfx_buffer)
+
+uint8_t gfx_SetColor(uint8_t index);
+void gfx_FillScreen(uint8_t index);
+void gfx_SetPixel(unsigned x, uint8_t y);
+void gfx_FillRectangle(int x, int y, int width, int height);
+void gfx_Rectangle(int x, int y, int width, int height);
+void gfx_HorizLine(int x, int y, int length);
+void gfx_VertLine(int x, int y, int length);
+void gfx_Line(int x0, int y0, int x1, int y1);
+void gfx_Circle(int x, int y, unsigned radius);
+void gfx_FillCircle(int x, int y, unsigned radius);
+void gfx_FillTriangle(int x0, int y0, int x1, int y1, int x2, int y2);
+
+gfx_sprite_t *gfx_GetSprite(gfx_sprite_t *sprite_buffer, int x, int y);
+void gfx_Sprite_NoClip(const gfx_sprite_t *sprite, unsigned x, uint8_t y);
+gfx_rletsprite_t *gfx_ConvertToNewRLETSprite(const gfx_sprite_t *sprite_in, void *(*malloc_routine)(size_t));
+void gfx_RLETSprite_NoClip(const gfx_rletsprite_t *sprite, unsigned x, uint8_t y);
+
+uint8_t gfx_SetTextFGColor(uint8_t color);
+uint8_t gfx_SetTextBGColor(uint8_t color);
+uint8_t gfx_SetTextTransparentColor(uint8_t color);
+void gfx_SetTextScale(uint8_t width_scale, uint8_t height_scale);
+void gfx_PrintStringXY(const char *string, int x, int y);
+unsigned gfx_GetStringWidth(const char *string);
+
+#endif
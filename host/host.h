@@ -0,0 +1,49 @@
+/*  host/host.h
+    Interno do backend de PC: contadores por quadro e relatório por tela.
+
+    Um quadro vai da apresentação anterior até a próxima (gfx_SwapDraw,
+    gfx_Blit*); fecha no kb_Scan seguinte. A tela de um quadro é o primeiro
+    texto escrito depois do último gfx_FillScreen (o título, em geral).
+    Relógio virtual (ms): CPU do PC + delay() pedidos + custo de cada
+    kb_Scan. O roteiro de teclas anda nesse relógio, então a latência de
+    uma tecla (aperto no roteiro -> primeira apresentação depois que o
+    programa a viu) inclui o tempo perdido em polling e delay(). Tempo em
+    host_dormir é espera com prazo (entrada_dormir), contada à parte.
+
+    Autor: https://github.com/daniSoares08
+*/
+
+#ifndef HOST_H
+#define HOST_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef struct {
+    unsigned long chamadas;   /* chamadas gfx_* de desenho                */
+    unsigned long pixels;     /* pixels escritos no buffer de desenho     */
+    unsigned long lcd_px;     /* pixels que chegaram ao LCD (swap/blit)   */
+    unsigned long glifos;     /* caracteres rasterizados glifo a glifo    */
+    unsigned long sprites;    /* sprites blitados (cache de texto etc.)   */
+    unsigned long delay_ms;   /* soma dos delay() pedidos                 */
+    unsigned long teclas;     /* teclas respondidas neste quadro          */
+    double        lat_ms;     /* soma das latências dessas teclas         */
+    double        lat_max;
+} HostContagem;
+
+extern HostContagem host_q;   /* quadro corrente */
+
+void host_iniciar(void);                /* gfx_Begin: zera o relógio, abre saídas */
+void host_limpou(void);                 /* gfx_FillScreen: próxima string nomeia a tela */
+void host_texto(const char *s);         /* gfx_PrintStringXY */
+void host_apresentou(unsigned long px); /* swap/blit: px chegaram ao LCD */
+void host_scan(bool teclado_mudou);     /* kb_Scan: fecha o quadro apresentado */
+double host_relogio_ms(void);           /* relógio virtual */
+void host_avancar(double ms);           /* delay() e custo de kb_Scan */
+void host_tecla(double apertou_ms);     /* kb_Scan viu uma tecla apertada nesse instante */
+void host_tecla_perdida(void);          /* toque inteiro entre dois kb_Scan */
+void host_dormir(double ms);            /* espera de src/entrada.c (MECSOL_HOST) */
+void host_esperou(double ms);           /* uma espera de ms no relógio */
+const uint8_t *host_lcd(void);          /* buffer visível, 320x240 índices */
+
+#endif
@@ -0,0 +1,161 @@
+/*  host/keypadc.c
+    Substituto do keypadc (CEdev) para rodar MECSOL no PC
+    O roteiro de teclas (MECSOL_TECLAS=arq) corre no relógio virtual
+    (host.h); cada kb_Scan lê o estado do teclado naquele instante.
+    Formato, separado por espaços ('#' comenta até o fim da linha):
+      ENTER CLEAR DEL UP DOWN LEFT RIGHT TRACE 2ND ADD SUB CHS DOT 0..9
+      12.5 / -3      número: uma tecla por caractere ('-' vira CHS)
+      RIGHT*400      segura por 400 ms
+      ~500           500 ms sem tecla
+    Cada toque fica TOQUE_MS apertado e TOQUE_MS solto. Um toque que cai
+    inteiro entre dois kb_Scan se perde (conta no relatório). Fim do
+    roteiro = ON apertado; se o programa não sair em MAX_SOBRA_MS, o
+    backend encerra sozinho. MECSOL_SCAN_US = custo de um kb_Scan.
+    host_dormir faz o papel da espera de entrada_dormir: adianta o relógio
+    o mesmo prazo fixo da calculadora e, em varredura contínua, atualiza
+    kb_Data como o controlador do teclado faria.
+
+    Autor: https://github.com/daniSoares08
+*/
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "keypadc.h"
+#include "host.h"
+
+#define TOQUE_MS     50
+#define MAX_SOBRA_MS 10000.0
+#define SCAN_US      200.0    /* kb_Scan no CE: varredura completa do teclado */
+
+volatile uint8_t kb_Data[8];
+volatile uint8_t kb_On;
+
+typedef struct { const char *nome; kb_lkey_t tecla; } NomeTecla;
+
+static const NomeTecla NOMES[] = {
+    { "ENTER", kb_KeyEnter }, { "CLEAR", kb_KeyClear }, { "DEL", kb_KeyDel },
+    { "UP", kb_KeyUp }, { "DOWN", kb_KeyDown }, { "LEFT", kb_KeyLeft }, { "RIGHT", kb_KeyRight },
+    { "TRACE", kb_KeyTrace }, { "2ND", kb_Key2nd }, { "ADD", kb_KeyAdd }, { "SUB", kb_KeySub },
+    { "CHS", kb_KeyChs }, { "DOT", kb_KeyDecPnt },
+    { "0", kb_Key0 }, { "1", kb_Key1 }, { "2", kb_Key2 }, { "3", kb_Key3 }, { "4", kb_Key4 },
+    { "5", kb_Key5 }, { "6", kb_Key6 }, { "7", kb_Key7 }, { "8", kb_Key8 }, { "9", kb_Key9 },
+};
+
+/* um toque: apertada em [ini, fim) do relógio virtual (ms desde o 1º scan) */
+typedef struct {
+    kb_lkey_t tecla;
+    double    ini, fim;
+    bool      visto;
+} Toque;
+
+static Toque        *toques = NULL;
+static size_t        n_toques = 0, cap_toques = 0, prox = 0;
+static double        cursor = 0.0, t0 = 0.0, scan_ms = SCAN_US / 1000.0;
+static bool          carregado = false;
+static kb_scan_mode_t modo = MODE_0_IDLE;
+
+static void empurrar(kb_lkey_t k, double segura) {
+    if (n_toques == cap_toques) {
+        cap_toques = cap_toques ? 2 * cap_toques : 256;
+        toques = realloc(toques, cap_toques * sizeof *toques);
+        if (!toques) { fprintf(stderr, "host: sem memoria p/ roteiro\n"); exit(2); }
+    }
+    toques[n_toques++] = (Toque){ k, cursor, cursor + segura, false };
+    cursor += segura + TOQUE_MS;
+}
+
+static bool tecla_por_nome(const char *s, kb_lkey_t *k) {
+    for (size_t i = 0; i < sizeof NOMES / sizeof NOMES[0]; i++)
+        if (strcmp(NOMES[i].nome, s) == 0) { *k = NOMES[i].tecla; return true; }
+    return false;
+}
+
+static void token(char *t) {
+    kb_lkey_t k;
+    if (t[0] == '~') { cursor += atof(t + 1); return; }
+
+    double segura = TOQUE_MS;
+    char *ast = strchr(t, '*');
+    if (ast) { *ast = '\0'; segura = atof(ast + 1); }
+    for (char *p = t; *p; p++) *p = (char)toupper((unsigned char)*p);
+
+    if (tecla_por_nome(t, &k)) { empurrar(k, segura); return; }
+
+    /* número: dígito a dígito */
+    for (char *p = t; *p; p++) {
+        char d[2] = { *p, '\0' };
+        if (*p == '-')      empurrar(kb_KeyChs, TOQUE_MS);
+        else if (*p == '.') empurrar(kb_KeyDecPnt, TOQUE_MS);
+        else if (tecla_por_nome(d, &k)) empurrar(k, TOQUE_MS);
+        else fprintf(stderr, "host: tecla desconhecida '%s'\n", t);
+    }
+}
+
+static void carregar(void) {
+    carregado = true;
+    const char *us = getenv("MECSOL_SCAN_US");
+    if (us && *us) scan_ms = atof(us) / 1000.0;
+    t0 = host_relogio_ms();
+    const char *arq = getenv("MECSOL_TECLAS");
+    if (!arq || !*arq) return;
+    FILE *f = fopen(arq, "r");
+    if (!f) { fprintf(stderr, "host: nao abri roteiro %s\n", arq); exit(2); }
+    char linha[512];
+    while (fgets(linha, sizeof linha, f)) {
+        char *c = strchr(linha, '#');
+        if (c) *c = '\0';
+        for (char *t = strtok(linha, " \t\r\n"); t; t = strtok(NULL, " \t\r\n")) token(t);
+    }
+    fclose(f);
+}
+
+/* kb_Data/kb_On no instante agora (ms desde o 1º scan); true se mudou */
+static bool amostrar(double agora) {
+    uint8_t antes[8];
+    memcpy(antes, (const void *)kb_Data, sizeof antes);
+    memset((void *)kb_Data, 0, sizeof antes);
+
+    /* toques já soltos saem da janela; os que ninguém viu se perderam */
+    while (prox < n_toques && toques[prox].fim <= agora) {
+        if (!toques[prox].visto) host_tecla_perdida();
+        prox++;
+    }
+    for (size_t i = prox; i < n_toques && toques[i].ini <= agora; i++) {
+        Toque *t = &toques[i];
+        if (t->fim <= agora) continue;
+        kb_Data[t->tecla >> 8] |= (uint8_t)(t->tecla & 0xFF);
+        if (!t->visto) { t->visto = true; host_tecla(t0 + t->ini); }
+    }
+
+    bool acabou = (prox == n_toques && agora >= cursor);
+    bool on_antes = kb_On;
+    kb_On = acabou;
+    if (acabou && agora > cursor + MAX_SOBRA_MS) {
+        fprintf(stderr, "host: roteiro acabou e o programa nao saiu\n");
+        exit(1);
+    }
+    return memcmp(antes, (const void *)kb_Data, sizeof antes) != 0 || kb_On != on_antes;
+}
+
+void kb_Scan(void) {
+    if (!carregado) carregar();
+    modo = MODE_2_SINGLE;
+    host_avancar(scan_ms);
+    host_scan(amostrar(host_relogio_ms() - t0));
+}
+
+void kb_SetMode(kb_scan_mode_t mode) {
+    modo = mode;
+}
+
+void host_dormir(double ms) {
+    if (!carregado) carregar();
+    host_esperou(ms);
+    if (modo == MODE_3_CONTINUOUS) amostrar(host_relogio_ms() - t0);
+}
+
+void kb_DisableOnLatch(void) {
+}
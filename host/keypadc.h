@@ -0,0 +1,95 @@
+/*  host/keypadc.h
+    Substituto do keypadc (CEdev) para rodar MECSOL no PC
+    kb_Scan lê o estado das teclas de um roteiro (MECSOL_TECLAS); mesmos
+    grupos e bits do teclado do CE, então kb_Data[g] & kb_X funciona igual.
+
+    Autor: https://github.com/daniSoares08
+*/
+
+#ifndef HOST_KEYPADC_H
+#define HOST_KEYPADC_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef uint16_t kb_lkey_t;   /* (grupo << 8) | bit */
+
+extern volatile uint8_t kb_Data[8];
+extern volatile uint8_t kb_On;
+
+typedef enum {
+    MODE_0_IDLE = 0,
+    MODE_1_INDISCRIMINATE,
+    MODE_2_SINGLE,
+    MODE_3_CONTINUOUS,
+} kb_scan_mode_t;
+
+void kb_Scan(void);                     /* varredura única (deixa o modo em SINGLE) */
+void kb_SetMode(kb_scan_mode_t mode);   /* CONTINUOUS: kb_Data acompanha o teclado */
+void kb_DisableOnLatch(void);
+
+#define kb_IsDown(lkey) (kb_Data[(lkey) >> 8] & ((lkey) & 0xFF))
+
+/* grupo 1 */
+#define kb_Graph    (1 << 0)
+#define kb_Trace    (1 << 1)
+#define kb_Zoom     (1 << 2)
+#define kb_Window   (1 << 3)
+#define kb_Yequ     (1 << 4)
+#define kb_2nd      (1 << 5)
+#define kb_Mode     (1 << 6)
+#define kb_Del      (1 << 7)
+/* grupo 3 */
+#define kb_0        (1 << 0)
+#define kb_1        (1 << 1)
+#define kb_4        (1 << 2)
+#define kb_7        (1 << 3)
+/* grupo 4 */
+#define kb_DecPnt   (1 << 0)
+#define kb_2        (1 << 1)
+#define kb_5        (1 << 2)
+#define kb_8        (1 << 3)
+/* grupo 5 */
+#define kb_Chs      (1 << 0)
+#define kb_3        (1 << 1)
+#define kb_6        (1 << 2)
+#define kb_9        (1 << 3)
+/* grupo 6 */
+#define kb_Enter    (1 << 0)
+#define kb_Add      (1 << 1)
+#define kb_Sub      (1 << 2)
+#define kb_Mul      (1 << 3)
+#define kb_Div      (1 << 4)
+#define kb_Power    (1 << 5)
+#define kb_Clear    (1 << 6)
+/* grupo 7 */
+#define kb_Down     (1 << 0)
+#define kb_Left     (1 << 1)
+#define kb_Right    (1 << 2)
+#define kb_Up       (1 << 3)
+
+#define kb_KeyTrace   ((kb_lkey_t)(1 << 8 | kb_Trace))
+#define kb_Key2nd     ((kb_lkey_t)(1 << 8 | kb_2nd))
+#define kb_KeyDel     ((kb_lkey_t)(1 << 8 | kb_Del))
+#define kb_Key0       ((kb_lkey_t)(3 << 8 | kb_0))
+#define kb_Key1       ((kb_lkey_t)(3 << 8 | kb_1))
+#define kb_Key4       ((kb_lkey_t)(3 << 8 | kb_4))
+#define kb_Key7       ((kb_lkey_t)(3 << 8 | kb_7))
+#define kb_KeyDecPnt  ((kb_lkey_t)(4 << 8 | kb_DecPnt))
+#define kb_Key2       ((kb_lkey_t)(4 << 8 | kb_2))
+#define kb_Key5       ((kb_lkey_t)(4 << 8 | kb_5))
+#define kb_Key8       ((kb_lkey_t)(4 << 8 | kb_8))
+#define kb_KeyChs     ((kb_lkey_t)(5 << 8 | kb_Chs))
+#define kb_Key3       ((kb_lkey_t)(5 << 8 | kb_3))
+#define kb_Key6       ((kb_lkey_t)(5 << 8 | kb_6))
+#define kb_Key9       ((kb_lkey_t)(5 << 8 | kb_9))
+#define kb_KeyEnter   ((kb_lkey_t)(6 << 8 | kb_Enter))
+#define kb_KeyAdd     ((kb_lkey_t)(6 << 8 | kb_Add))
+#define kb_KeySub     ((kb_lkey_t)(6 << 8 | kb_Sub))
+#define kb_KeyClear   ((kb_lkey_t)(6 << 8 | kb_Clear))
+#define kb_KeyDown    ((kb_lkey_t)(7 << 8 | kb_Down))
+#define kb_KeyLeft    ((kb_lkey_t)(7 << 8 | kb_Left))
+#define kb_KeyRight   ((kb_lkey_t)(7 << 8 | kb_Right))
+#define kb_KeyUp      ((kb_lkey_t)(7 << 8 | kb_Up))
+
+#endif
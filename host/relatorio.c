@@ -0,0 +1,224 @@
+/*  host/relatorio.c
+    Backend de PC: fecha quadros, agrupa por tela e imprime o relatório
+    (ver host.h). Variáveis de ambiente:
+      MECSOL_RELATORIO=arq.csv   um quadro por linha
+      MECSOL_QUADROS=dir         dir/q0001.ppm, ... (LCD de cada quadro)
+      MECSOL_TEXTO=arq           todo gfx_PrintStringXY, "quadro<TAB>texto"
+      MECSOL_CPU_X=k             CPU do PC conta k vezes no relógio virtual
+                                 (padrão 1; o eZ80 é bem mais lento)
+
+    Autor: https://github.com/daniSoares08
+*/
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "graphx.h"
+#include "host.h"
+
+#define MAX_TELAS 64
+#define NOME      40
+
+typedef struct {
+    char          nome[NOME + 1];
+    unsigned long quadros;
+    double        us_soma, us_max;
+    HostContagem  soma;
+} HostTela;
+
+HostContagem host_q;
+
+static HostTela      telas[MAX_TELAS];
+static int           n_telas = 0;
+static HostContagem  total;
+static char          tela_atual[NOME + 1] = "(inicio)";
+static bool          nomear = false;
+static bool          apresentado = false;
+static double        t_ref, t_apres;
+static unsigned long n_quadros = 0, n_scans = 0;
+static FILE         *csv = NULL, *texto = NULL;
+static const char   *dir_ppm = NULL;
+static bool          iniciado = false;
+
+/* relógio virtual e a tecla vista que ainda não chegou ao LCD */
+static double        cpu0, extra_ms = 0.0, cpu_x = 1.0;
+static double        pendente;
+static bool          ha_pendente = false;
+static unsigned long sem_efeito = 0, perdidas = 0;
+static double        esperado_ms = 0.0;
+static unsigned long esperas = 0;
+
+static double agora_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+    return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+static void somar(HostContagem *a, const HostContagem *b) {
+    a->chamadas += b->chamadas;
+    a->pixels   += b->pixels;
+    a->lcd_px   += b->lcd_px;
+    a->glifos   += b->glifos;
+    a->sprites  += b->sprites;
+    a->delay_ms += b->delay_ms;
+    a->teclas   += b->teclas;
+    a->lat_ms   += b->lat_ms;
+    if (b->lat_max > a->lat_max) a->lat_max = b->lat_max;
+}
+
+static HostTela *tela_de(const char *nome) {
+    for (int i = 0; i < n_telas; i++)
+        if (strcmp(telas[i].nome, nome) == 0) return &telas[i];
+    HostTela *t = &telas[n_telas < MAX_TELAS ? n_telas++ : MAX_TELAS - 1];
+    if (t->quadros == 0) snprintf(t->nome, sizeof t->nome, "%s", nome);
+    return t;
+}
+
+static void gravar_ppm(void) {
+    char caminho[512];
+    snprintf(caminho, sizeof caminho, "%s/q%04lu.ppm", dir_ppm, n_quadros);
+    FILE *f = fopen(caminho, "wb");
+    if (!f) return;
+    fprintf(f, "P6\n%d %d\n255\n", GFX_LCD_WIDTH, GFX_LCD_HEIGHT);
+    const uint8_t *p = host_lcd();
+    for (int i = 0; i < GFX_LCD_WIDTH * GFX_LCD_HEIGHT; i++) {
+        uint16_t c = gfx_palette[p[i]];
+        uint8_t rgb[3] = { (uint8_t)(((c >> 10) & 31) << 3),
+                           (uint8_t)(((c >> 5) & 31) << 3),
+                           (uint8_t)((c & 31) << 3) };
+        fwrite(rgb, 1, 3, f);
+    }
+    fclose(f);
+}
+
+static void fechar_quadro(void);
+
+static void relatorio(void) {
+    if (apresentado) fechar_quadro();
+    if (ha_pendente) sem_efeito++;
+    somar(&total, &host_q);
+    printf("\n%-40s %7s %6s %7s %7s %8s %9s %10s %10s %7s\n", "tela", "quadros", "teclas",
+           "lat_ms", "max_ms", "cpu_us", "chamadas", "pixels", "lcd_px", "glifos");
+    for (int i = 0; i < n_telas; i++) {
+        const HostTela *t = &telas[i];
+        printf("%-40s %7lu %6lu %7.1f %7.1f %8.0f %9lu %10lu %10lu %7lu\n",
+               t->nome, t->quadros, t->soma.teclas,
+               t->soma.teclas ? t->soma.lat_ms / t->soma.teclas : 0.0, t->soma.lat_max,
+               t->us_soma / t->quadros, t->soma.chamadas, t->soma.pixels, t->soma.lcd_px,
+               t->soma.glifos);
+    }
+    printf("total: %lu quadros, %lu kb_Scan, %lu chamadas, %lu pixels, %lu px no LCD, "
+           "%lu sprites, %lu ms de delay\n",
+           n_quadros, n_scans, total.chamadas, total.pixels, total.lcd_px,
+           total.sprites, total.delay_ms);
+    printf("teclas: %lu respondidas, latencia media %.1f ms (max %.1f), %lu sem efeito, "
+           "%lu perdidas; relogio %.0f ms\n",
+           total.teclas, total.teclas ? total.lat_ms / total.teclas : 0.0, total.lat_max,
+           sem_efeito, perdidas, host_relogio_ms());
+    double rel = host_relogio_ms();
+    printf("espera: %lu em entrada_dormir, %.0f ms de %.0f (%.0f%%); resto em varredura/desenho\n",
+           esperas, esperado_ms, rel, rel > 0.0 ? 100.0 * esperado_ms / rel : 0.0);
+    if (csv) fclose(csv);
+    if (texto) fclose(texto);
+}
+
+void host_iniciar(void) {
+    if (iniciado) return;
+    iniciado = true;
+    const char *arq = getenv("MECSOL_RELATORIO");
+    if (arq && *arq && (csv = fopen(arq, "w")) != NULL)
+        fprintf(csv, "quadro,tela,cpu_us,chamadas,pixels,lcd_px,glifos,sprites,delay_ms,"
+                     "teclas,lat_ms,lat_max\n");
+    const char *tx = getenv("MECSOL_TEXTO");
+    if (tx && *tx) texto = fopen(tx, "w");
+    dir_ppm = getenv("MECSOL_QUADROS");
+    if (dir_ppm && !*dir_ppm) dir_ppm = NULL;
+    const char *x = getenv("MECSOL_CPU_X");
+    if (x && *x) cpu_x = atof(x);
+    t_ref = cpu0 = agora_us();
+    atexit(relatorio);
+}
+
+void host_limpou(void) {
+    nomear = true;
+}
+
+void host_texto(const char *s) {
+    if (texto) fprintf(texto, "%lu\t%s\n", n_quadros + 1, s);
+    if (!nomear) return;
+    snprintf(tela_atual, sizeof tela_atual, "%s", s);
+    nomear = false;
+}
+
+void host_apresentou(unsigned long px) {
+    if (!iniciado) host_iniciar();
+    host_q.lcd_px += px;
+    apresentado = true;
+    t_apres = agora_us();
+
+    if (ha_pendente) {
+        double lat = host_relogio_ms() - pendente;
+        host_q.teclas++;
+        host_q.lat_ms += lat;
+        if (lat > host_q.lat_max) host_q.lat_max = lat;
+        ha_pendente = false;
+    }
+}
+
+double host_relogio_ms(void) {
+    if (!iniciado) host_iniciar();
+    return (agora_us() - cpu0) / 1000.0 * cpu_x + extra_ms;
+}
+
+void host_avancar(double ms) {
+    extra_ms += ms;
+}
+
+void host_esperou(double ms) {
+    extra_ms += ms;
+    esperado_ms += ms;
+    esperas++;
+}
+
+/* tecla nova com outra ainda pendente: a anterior não mudou nada na tela */
+void host_tecla(double apertou_ms) {
+    if (ha_pendente) sem_efeito++;
+    pendente = apertou_ms;
+    ha_pendente = true;
+}
+
+void host_tecla_perdida(void) {
+    perdidas++;
+}
+
+static void fechar_quadro(void) {
+    double us = t_apres - t_ref;
+    n_quadros++;
+    HostTela *t = tela_de(tela_atual);
+    t->quadros++;
+    t->us_soma += us;
+    if (us > t->us_max) t->us_max = us;
+    somar(&t->soma, &host_q);
+    somar(&total, &host_q);
+    if (csv)
+        fprintf(csv, "%lu,\"%s\",%.0f,%lu,%lu,%lu,%lu,%lu,%lu,%lu,%.1f,%.1f\n", n_quadros,
+                tela_atual, us, host_q.chamadas, host_q.pixels, host_q.lcd_px, host_q.glifos,
+                host_q.sprites, host_q.delay_ms, host_q.teclas, host_q.lat_ms, host_q.lat_max);
+    if (dir_ppm) gravar_ppm();
+    memset(&host_q, 0, sizeof host_q);
+}
+
+void host_scan(bool teclado_mudou) {
+    if (!iniciado) host_iniciar();
+    n_scans++;
+    if (apresentado) {
+        fechar_quadro();
+        apresentado = false;
+        t_ref = agora_us();
+    }
+    if (teclado_mudou) t_ref = agora_us();
+}
@@ -0,0 +1,14 @@
+/*  host/tice.c
+    Substituto do tice (CEdev) para rodar MECSOL no PC
+
+    Autor: https://github.com/daniSoares08
+*/
+
+#include "tice.h"
+#include "host.h"
+
+/* não dorme de verdade: só adianta o relógio virtual */
+void delay(uint16_t msec) {
+    host_q.delay_ms += msec;
+    host_avancar(msec);
+}
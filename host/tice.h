@@ -0,0 +1,17 @@
+/*  host/tice.h
+    Substituto do tice (CEdev) para rodar MECSOL no PC
+    delay não dorme: só soma os ms pedidos (aparecem no relatório).
+
+    Autor: https://github.com/daniSoares08
+*/
+
+#ifndef HOST_TICE_H
+#define HOST_TICE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+void delay(uint16_t msec);
+
+#endif
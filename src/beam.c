@@ -6,31 +6,62 @@
 #include "beam.h"
 #include <math.h>
 
-static inline float clampf(float v, float lo, float hi){
+static inline real_t clampf(real_t v, real_t lo, real_t hi){
     return v<lo?lo:(v>hi?hi:v);
 }
 
-void beam_init(Beam *b, float L, float EI, float P, float a){
-    b->L = (L>0?L:1.0f);
-    b->EI = (EI>0?EI:1.0e4f);
+void beam_init(Beam *b, real_t L, real_t EI, real_t P, real_t a){
+    b->caso = BEAM_BIAPOIADA_P;
+    b->q = 0.0;
+    b->MA = 0.0;
+    b->L = (L>0?L:1.0);
+    b->EI = (EI>0?EI:1.0e4);
     b->P = P;
-    b->a = clampf(a, 0.0f, b->L);
-    b->RA = b->RB = 0.0f;
-    b->C1 = b->C3 = b->C4 = 0.0f;
+    b->a = clampf(a, 0.0, b->L);
+    b->RA = b->RB = 0.0;
+    b->C1 = b->C3 = b->C4 = 0.0;
     beam_solve(b);
 }
 
-void beam_set_pointload(Beam *b, float P, float a){
+// biapoiada com q uniforme em todo o vão
+void beam_init_q(Beam *b, real_t L, real_t EI, real_t q){
+    beam_init(b, L, EI, 0.0, 0.0);
+    b->caso = BEAM_BIAPOIADA_Q;
+    b->q = q;
+    beam_solve(b);
+}
+
+// balanço: engaste em x=0, P na ponta livre (x=L)
+void beam_init_balanco(Beam *b, real_t L, real_t EI, real_t P){
+    beam_init(b, L, EI, P, L);
+    b->caso = BEAM_BALANCO_P;
+    beam_solve(b);
+}
+
+void beam_set_pointload(Beam *b, real_t P, real_t a){
     b->P = P;
-    b->a = clampf(a, 0.0f, b->L);
+    b->a = clampf(a, 0.0, b->L);
     beam_solve(b);
 }
 
 void beam_solve(Beam *b){
-    const float L = b->L;
-    const float a = b->a;
-    const float P = b->P;
-    const float EI = b->EI;
+    const real_t L = b->L;
+    const real_t a = b->a;
+    const real_t P = b->P;
+    const real_t EI = b->EI;
+
+    if (b->caso == BEAM_BIAPOIADA_Q) {
+        b->RA = b->RB = 0.5 * b->q * L;
+        b->C1 = b->C3 = b->C4 = 0.0;     // y, y' em forma fechada (y_of/theta_of)
+        return;
+    }
+    if (b->caso == BEAM_BALANCO_P) {
+        b->RA = P;
+        b->RB = 0.0;
+        b->MA = -P * L;                  // M(0) = -P L (tracionando em cima)
+        b->C1 = b->C3 = b->C4 = 0.0;     // y(0) = y'(0) = 0
+        return;
+    }
 
     // Reações (viga simplesmente apoiada)
     b->RA = P * (L - a) / L;
@@ -51,8 +82,8 @@ void beam_solve(Beam *b){
     //
     // Resolve (sistema 3x3 em C1, C3, C4). Fazemos algébrico direto:
 
-    float a2 = a*a, a3 = a2*a;
-    float L2 = L*L, L3 = L2*L;
+    real_t a2 = a*a, a3 = a2*a;
+    real_t L2 = L*L, L3 = L2*L;
 
     (void)a2; (void)a3; // não usados diretamente, mas mantidos para clareza
 
@@ -65,41 +96,110 @@ void beam_solve(Beam *b){
     // Então (3): C3 L = -[ RA L^3/(6EI) - P (L-a)^3/(6EI) ]
     // => C3 = -( RA L^3 - P (L-a)^3 ) / (6EI L)
 
-    float num = (b->RA * L3) - (P * powf(L - a, 3.0f));
-    b->C3 = b->C1 = -( num ) / (6.0f * EI * L);
-    b->C4 = 0.0f;
+    real_t num = (b->RA * L3) - (P * pow(L - a, 3.0));
+    b->C3 = b->C1 = -( num ) / (6.0 * EI * L);
+    b->C4 = 0.0;
 }
 
-float V_of(const Beam *b, float x){
+real_t V_of(const Beam *b, real_t x){
+    if (b->caso == BEAM_BIAPOIADA_Q) return b->q * (0.5 * b->L - x);
+    if (b->caso == BEAM_BALANCO_P)   return b->P;
     // cortante: RA - P*H(x-a)
     if (x < b->a) return b->RA;
     return b->RA - b->P;
 }
 
-float M_of(const Beam *b, float x){
+real_t M_of(const Beam *b, real_t x){
+    if (b->caso == BEAM_BIAPOIADA_Q) return 0.5 * b->q * x * (b->L - x);
+    if (b->caso == BEAM_BALANCO_P)   return b->P * (x - b->L);
     // momento: RA x - P (x-a)H(x-a)
     if (x < b->a) return b->RA * x;
     return b->RA * x - b->P * (x - b->a);
 }
 
-float theta_of(const Beam *b, float x){
-    const float EI = b->EI;
+real_t theta_of(const Beam *b, real_t x){
+    const real_t EI = b->EI;
+    const real_t L = b->L;
+    // q: y' = q/(24EI) (6Lx^2 - 4x^3 - L^3) ; balanço: y' = P/EI (x^2/2 - Lx)
+    if (b->caso == BEAM_BIAPOIADA_Q) return b->q * (6.0*L*x*x - 4.0*x*x*x - L*L*L) / (24.0 * EI);
+    if (b->caso == BEAM_BALANCO_P)   return b->P * (0.5*x*x - L*x) / EI;
     if (x < b->a){
-        return (b->RA * x*x) / (2.0f * EI) + b->C1;
+        return (b->RA * x*x) / (2.0 * EI) + b->C1;
     } else {
-        float xm = x - b->a;
-        return (b->RA * x*x) / (2.0f * EI) - (b->P * xm*xm) / (2.0f * EI) + b->C3;
+        real_t xm = x - b->a;
+        return (b->RA * x*x) / (2.0 * EI) - (b->P * xm*xm) / (2.0 * EI) + b->C3;
     }
 }
 
-float y_of(const Beam *b, float x){
-    const float EI = b->EI;
+real_t y_of(const Beam *b, real_t x){
+    const real_t EI = b->EI;
+    const real_t L = b->L;
+    // q: y = q/(24EI) (2Lx^3 - x^4 - L^3 x) ; balanço: y = P/EI (x^3/6 - Lx^2/2)
+    if (b->caso == BEAM_BIAPOIADA_Q) return b->q * (2.0*L*x*x*x - x*x*x*x - L*L*L*x) / (24.0 * EI);
+    if (b->caso == BEAM_BALANCO_P)   return b->P * (x*x*x/6.0 - 0.5*L*x*x) / EI;
     if (x < b->a){
-        return (b->RA * x*x*x) / (6.0f * EI) + b->C1 * x; // C2=0
+        return (b->RA * x*x*x) / (6.0 * EI) + b->C1 * x; // C2=0
     } else {
-        float xm = x - b->a;
-        return (b->RA * x*x*x) / (6.0f * EI)
-             - (b->P * xm*xm*xm) / (6.0f * EI)
+        real_t xm = x - b->a;
+        return (b->RA * x*x*x) / (6.0 * EI)
+             - (b->P * xm*xm*xm) / (6.0 * EI)
              + b->C3 * x + b->C4;
     }
 }
+
+// ======== extremos ========
+
+// valor de maior módulo de f entre os candidatos xs
+static real_t maior_modulo(const Beam *b, real_t (*f)(const Beam *, real_t),
+                           const real_t *xs, int n, real_t *px){
+    real_t best = 0.0, bx = 0.0;
+    for (int i = 0; i < n; i++){
+        real_t v = f(b, xs[i]);
+        if (fabs(v) > fabs(best)) { best = v; bx = xs[i]; }
+    }
+    if (px) *px = bx;
+    return best;
+}
+
+// ponto crítico de M (V = 0) e de y (y' = 0) em cada caso
+static real_t x_pico_M(const Beam *b){
+    if (b->caso == BEAM_BIAPOIADA_Q) return 0.5 * b->L;
+    if (b->caso == BEAM_BALANCO_P)   return 0.0;
+    return b->a;
+}
+
+static real_t x_pico_y(const Beam *b){
+    const real_t L = b->L;
+    if (b->caso == BEAM_BIAPOIADA_Q) return 0.5 * L;
+    if (b->caso == BEAM_BALANCO_P)   return L;
+    // carga em a, bb = L - a: flecha máxima do lado do trecho maior
+    real_t bb = L - b->a;
+    if (b->a >= bb) return sqrt((L*L - bb*bb) / 3.0);
+    return L - sqrt((L*L - b->a*b->a) / 3.0);
+}
+
+void beam_M_extremos(const Beam *b, real_t *Mmax, real_t *xmax, real_t *Mmin, real_t *xmin){
+    real_t xs[3] = { 0.0, b->L, x_pico_M(b) };
+    *Mmax = -1e30; *Mmin = 1e30;
+    for (int i = 0; i < 3; i++){
+        real_t M = M_of(b, xs[i]);
+        if (M > *Mmax) { *Mmax = M; if (xmax) *xmax = xs[i]; }
+        if (M < *Mmin) { *Mmin = M; if (xmin) *xmin = xs[i]; }
+    }
+}
+
+real_t beam_V_max(const Beam *b, real_t *px){
+    real_t xs[2] = { 0.0, b->L };
+    return maior_modulo(b, V_of, xs, 2, px);
+}
+
+real_t beam_y_max(const Beam *b, real_t *px){
+    real_t xs[1] = { x_pico_y(b) };
+    return maior_modulo(b, y_of, xs, 1, px);
+}
+
+// M não muda de sinal nos três casos -> y' é monótona, extremos nas pontas
+real_t beam_theta_max(const Beam *b, real_t *px){
+    real_t xs[2] = { 0.0, b->L };
+    return maior_modulo(b, theta_of, xs, 2, px);
+}
@@ -8,27 +8,47 @@
 
 #include <stddef.h>
 
+#include "real.h"
+
+// casos de livro com forma fechada
+enum {
+    BEAM_BIAPOIADA_P,   // apoios em 0 e L, carga pontual P em a
+    BEAM_BIAPOIADA_Q,   // apoios em 0 e L, carga uniforme q em todo o vão
+    BEAM_BALANCO_P      // engaste em 0, carga pontual P na ponta (x = L)
+};
+
 typedef struct {
-    float L;     // comprimento [m]
-    float EI;    // rigidez flexional [N*m^2]
+    int caso;     // BEAM_*
+    real_t L;     // comprimento [m]
+    real_t EI;    // rigidez flexional [N*m^2]
     // carga pontual única
-    float P;     // intensidade [N] (positivo p/ baixo)
-    float a;     // posição da carga [m], 0<=a<=L
+    real_t P;     // intensidade [N] (positivo p/ baixo)
+    real_t a;     // posição da carga [m], 0<=a<=L
+    real_t q;     // carga uniforme [N/m] (positivo p/ baixo)
 
     // reações e constantes de integração
-    float RA, RB;
-    float C1, C3, C4; // p/ y' / y nas duas regiões
+    real_t RA, RB;
+    real_t MA;         // momento de engaste (balanço), mesma convenção de viga.c
+    real_t C1, C3, C4; // p/ y' / y nas duas regiões
 
 } Beam;
 
-void beam_init(Beam *b, float L, float EI, float P, float a);
-void beam_set_pointload(Beam *b, float P, float a);
+void beam_init(Beam *b, real_t L, real_t EI, real_t P, real_t a);
+void beam_init_q(Beam *b, real_t L, real_t EI, real_t q);
+void beam_init_balanco(Beam *b, real_t L, real_t EI, real_t P);
+void beam_set_pointload(Beam *b, real_t P, real_t a);
 void beam_solve(Beam *b);
 
 // grandezas por trechos (0<=x<a) e (a<=x<=L)
-float V_of(const Beam *b, float x);
-float M_of(const Beam *b, float x);
-float theta_of(const Beam *b, float x);   // y' (rad), retorna (1/EI)*∫Mdx + constante
-float y_of(const Beam *b, float x);       // deflexão [m]
+real_t V_of(const Beam *b, real_t x);
+real_t M_of(const Beam *b, real_t x);
+real_t theta_of(const Beam *b, real_t x);   // y' (rad), retorna (1/EI)*∫Mdx + constante
+real_t y_of(const Beam *b, real_t x);       // deflexão [m]
+
+// extremos exatos em [0,L]: candidatos = extremidades + ponto crítico do caso
+void   beam_M_extremos(const Beam *b, real_t *Mmax, real_t *xmax, real_t *Mmin, real_t *xmin);
+real_t beam_V_max(const Beam *b, real_t *px);       // V de maior módulo (com sinal)
+real_t beam_y_max(const Beam *b, real_t *px);       // y de maior módulo (com sinal)
+real_t beam_theta_max(const Beam *b, real_t *px);   // y' de maior módulo (com sinal)
 
 #endif
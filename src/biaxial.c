@@ -0,0 +1,216 @@
+/*  src/biaxial.c
+    FLEXAO OBLIQUA (Mx, My com Ixy) para MECSOL - TI-84 Plus CE
+    sig(x,y) é linear na seção, então os extremos caem em vértices do fecho
+    convexo da região. O fecho é montado uma vez por figura (cache pela
+    revisão do centroid.c); cada par (Mx, My) acha as duas fibras extremas
+    por busca binária nos ângulos das arestas, O(log h).
+
+    Candidatos a vértice: cantos dos retângulos e cruzamentos de bordas
+    horizontais com verticais, mantidos só se estiverem no fecho da região
+    U(materiais) - U(recortes) (mesma regra do uniao.c).
+
+    Autor: https://github.com/daniSoares08
+*/
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "secao.h"
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+#define MAX_PTS 96
+
+typedef struct { real_t x, y; } Pt;
+
+static Pt     buf[MAX_PTS];        /* candidatos (vira o fecho ao encher)  */
+static int    nbuf = 0;
+static Pt     casco[MAX_PTS + 1];  /* fecho CCW, relativo ao centroide      */
+static real_t ang[MAX_PTS];        /* ângulo da aresta k -> k+1, crescente  */
+static int    nc = 0;
+static real_t Ix = 0.0, Iy = 0.0, Ixy = 0.0;
+static unsigned rev_ok = 0;
+static bool ok = false;
+
+static int cmp_pt(const void *a, const void *b) {
+    const Pt *p = a, *q = b;
+    if (p->x != q->x) return (p->x > q->x) - (p->x < q->x);
+    return (p->y > q->y) - (p->y < q->y);
+}
+
+static real_t cruz(Pt o, Pt a, Pt b) {
+    return (a.x - o.x) * (b.y - o.y) - (a.y - o.y) * (b.x - o.x);
+}
+
+/* Andrew (monotone chain): fecho CCW de p[0..n) em casco[], sem colineares */
+static int fecho(Pt *p, int n) {
+    int k = 0;
+    if (n < 3) {
+        memcpy(casco, p, n * sizeof *p);
+        return n;
+    }
+    qsort(p, n, sizeof *p, cmp_pt);
+    for (int i = 0; i < n; i++) {
+        while (k >= 2 && cruz(casco[k-2], casco[k-1], p[i]) <= 0.0) k--;
+        casco[k++] = p[i];
+    }
+    for (int i = n - 2, t = k + 1; i >= 0; i--) {
+        while (k >= t && cruz(casco[k-2], casco[k-1], p[i]) <= 0.0) k--;
+        casco[k++] = p[i];
+    }
+    return k - 1;   /* último repete o primeiro */
+}
+
+/* guarda um candidato; buffer cheio -> troca pelo fecho dele (o fecho
+   de fecho(A) U B é o mesmo de A U B) */
+static void adicionar(real_t x, real_t y) {
+    if (nbuf == MAX_PTS) {
+        int h = fecho(buf, nbuf);
+        memcpy(buf, casco, h * sizeof *buf);
+        nbuf = h;
+    }
+    buf[nbuf].x = x;
+    buf[nbuf].y = y;
+    nbuf++;
+}
+
+static bool dentro(const Rect *r, real_t x, real_t y) {
+    return x > r->x0 && x < r->x0 + r->w && y > r->y0 && y < r->y0 + r->h;
+}
+
+/* ponto no fecho da região: algum quadrante vizinho tem material sem recorte */
+static bool na_regiao(const Rect *r, int n, real_t x, real_t y, real_t e) {
+    static const signed char Q[4][2] = { {1,1}, {-1,1}, {-1,-1}, {1,-1} };
+    for (int q = 0; q < 4; q++) {
+        real_t px = x + Q[q][0] * e, py = y + Q[q][1] * e;
+        bool mat = false, rec = false;
+        for (int i = 0; i < n; i++) {
+            if (!dentro(&r[i], px, py)) continue;
+            if (r[i].rec) rec = true; else mat = true;
+        }
+        if (mat && !rec) return true;
+    }
+    return false;
+}
+
+static bool preparar(void) {
+    unsigned rev = centroid_get_revisao();
+    if (ok && rev == rev_ok) return nc >= 3;
+
+    int n = 0;
+    const Rect *r = centroid_get_rects(&n);
+    const SecProps *p = centroid_get_props();
+    rev_ok = rev;
+    ok = true;
+    nc = 0;
+    if (!p || n <= 0) return false;
+
+    real_t e = 1e-7 * ((p->xmax - p->xmin) + (p->ymax - p->ymin));
+    nbuf = 0;
+    for (int i = 0; i < n; i++) {
+        real_t xs[2] = { r[i].x0, r[i].x0 + r[i].w };
+        real_t ys[2] = { r[i].y0, r[i].y0 + r[i].h };
+        /* borda horizontal de i contra borda vertical de j (j == i dá os cantos) */
+        for (int j = 0; j < n; j++) {
+            real_t xv[2] = { r[j].x0, r[j].x0 + r[j].w };
+            for (int a = 0; a < 2; a++) {
+                for (int b = 0; b < 2; b++) {
+                    real_t x = xv[b], y = ys[a];
+                    if (x < xs[0] || x > xs[1]) continue;
+                    if (y < r[j].y0 || y > r[j].y0 + r[j].h) continue;
+                    if (na_regiao(r, n, x, y, e)) adicionar(x, y);
+                }
+            }
+        }
+    }
+
+    int h = fecho(buf, nbuf);
+    if (h < 3) return false;
+
+    /* começa no vértice mais baixo (depois mais à esquerda): ângulos em [0, 2pi) crescentes */
+    int k0 = 0;
+    for (int k = 1; k < h; k++)
+        if (casco[k].y < casco[k0].y || (casco[k].y == casco[k0].y && casco[k].x < casco[k0].x)) k0 = k;
+    for (int k = 0; k < h; k++) {
+        buf[k].x = casco[(k0 + k) % h].x - p->xbar;
+        buf[k].y = casco[(k0 + k) % h].y - p->ybar;
+    }
+    memcpy(casco, buf, h * sizeof *buf);
+    for (int k = 0; k < h; k++) {
+        Pt a = casco[k], b = casco[(k + 1) % h];
+        real_t t = atan2(b.y - a.y, b.x - a.x);
+        ang[k] = (t < 0.0) ? t + 2.0 * M_PI : t;
+    }
+    nc = h;
+    Ix = p->Ix; Iy = p->Iy; Ixy = p->Ixy;
+    return true;
+}
+
+/* vértice do fecho que maximiza dx*x + dy*y: a primeira aresta com ângulo
+   >= ângulo(d) + pi/2 começa nele. O(log h). */
+static int suporte(real_t dx, real_t dy) {
+    real_t t = atan2(dy, dx) + 0.5 * M_PI;
+    while (t < 0.0) t += 2.0 * M_PI;
+    while (t >= 2.0 * M_PI) t -= 2.0 * M_PI;
+    int lo = 0, hi = nc;
+    while (lo < hi) {
+        int m = (lo + hi) / 2;
+        if (ang[m] < t) lo = m + 1; else hi = m;
+    }
+    return (lo == nc) ? 0 : lo;
+}
+
+/* sig = c1*x + c2*y (centroidal) com  Int sig*y dA = -Mx  e  Int sig*x dA = My;
+   com Ixy = 0 vira sig = -Mx*y/Ix + My*x/Iy */
+static bool coeficientes(real_t Mx, real_t My, real_t *c1, real_t *c2) {
+    real_t D = Ix * Iy - Ixy * Ixy;
+    if (D <= 0.0) return false;
+    *c1 =  (My * Ix + Mx * Ixy) / D;
+    *c2 = -(Mx * Iy + My * Ixy) / D;
+    return true;
+}
+
+bool biaxial_calcular(real_t Mx, real_t My, Biaxial *out) {
+    real_t c1, c2;
+    memset(out, 0, sizeof *out);
+    if (!preparar() || !coeficientes(Mx, My, &c1, &c2)) return false;
+    if (c1 == 0.0 && c2 == 0.0) return true;
+
+    Pt a = casco[suporte(c1, c2)];
+    Pt b = casco[suporte(-c1, -c2)];
+    out->sig_max = c1 * a.x + c2 * a.y;  out->x_max = a.x;  out->y_max = a.y;
+    out->sig_min = c1 * b.x + c2 * b.y;  out->x_min = b.x;  out->y_min = b.y;
+    out->c1 = c1;
+    out->c2 = c2;
+    return true;
+}
+
+/* muitos casos de carga: fecho preparado uma vez, O(log h) por par */
+int biaxial_lote(const real_t *Mx, const real_t *My, int n,
+                 real_t *sig_max, real_t *sig_min) {
+    if (!preparar()) return 0;
+    for (int i = 0; i < n; i++) {
+        real_t c1, c2;
+        if (!coeficientes(Mx[i], My[i], &c1, &c2)) return i;
+        Pt a = casco[suporte(c1, c2)];
+        Pt b = casco[suporte(-c1, -c2)];
+        sig_max[i] = c1 * a.x + c2 * a.y;
+        sig_min[i] = c1 * b.x + c2 * b.y;
+    }
+    return n;
+}
+
+/* vértices do fecho (centroidais, CCW) para desenhar; devolve h */
+int biaxial_casco(real_t *xs, real_t *ys, int max) {
+    if (!preparar()) return 0;
+    int h = (nc < max) ? nc : max;
+    for (int k = 0; k < h; k++) {
+        xs[k] = casco[k].x;
+        ys[k] = casco[k].y;
+    }
+    return h;
+}
@@ -0,0 +1,194 @@
+/*  src/bitmap.c
+    Importa SECAO de bitmap PBM/PGM (AppVar) para MECSOL - TI-84 Plus CE
+    Cada linha da máscara vira corridas de pixels de material; cada corrida
+    [a, b) entra nos momentos pela forma fechada (soma de (x+1)^k - x^k).
+      - P4 (PBM binário, 1 = preto = material): 8 pixels por byte, com
+        tabelas de 256 entradas (contagem de bits, soma de i, soma de
+        3i^2+3i) -> um acesso por byte, sem olhar pixel a pixel.
+      - P5 (PGM binário, maxval <= 255): pixel escuro (< maxval/2) é
+        material; corridas detectadas byte a byte.
+    Tudo é acumulado em inteiros de 64 bits em unidades de pixel (exato) e
+    só no fim vira metro. Lê a AppVar em blocos de uma linha.
+
+    Autor: https://github.com/daniSoares08
+*/
+
+#include <fileioc.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "secao.h"
+
+#define MAX_LINHA 1024      /* bytes por linha: P4 até 8192 px, P5 até 1024 px */
+
+static uint8_t  linha[MAX_LINHA];
+static uint8_t  POP[256];   /* bits em 1 no byte                    */
+static uint8_t  SI[256];    /* soma de i dos bits em 1 (i=0 no MSB) */
+static uint16_t SQ[256];    /* soma de 3i^2 + 3i dos bits em 1      */
+static bool tabelas_ok = false;
+
+/* acumuladores por linha, em pixels: n, Sum((x+1)^2-x^2), Sum((x+1)^3-x^3) */
+typedef struct { uint32_t n; uint64_t s1, s2; int x0, x1; } Linha;
+
+static void montar_tabelas(void) {
+    for (int m = 0; m < 256; m++) {
+        uint8_t p = 0, si = 0;
+        uint16_t sq = 0;
+        for (int i = 0; i < 8; i++) {
+            if (m & (0x80 >> i)) {
+                p++;
+                si += i;
+                sq += 3*i*i + 3*i;
+            }
+        }
+        POP[m] = p; SI[m] = si; SQ[m] = sq;
+    }
+    tabelas_ok = true;
+}
+
+/* corrida [a, b) de pixels de material */
+static void corrida(Linha *L, uint32_t a, uint32_t b) {
+    uint64_t A = a, B = b;
+    L->n  += b - a;
+    L->s1 += B*B - A*A;
+    L->s2 += B*B*B - A*A*A;
+    if ((int)a < L->x0) L->x0 = a;
+    if ((int)b > L->x1) L->x1 = b;
+}
+
+/* P4: byte k cobre x0 = 8k..8k+7; soma de 3x^2+3x+1 nos bits em 1 =
+   pop*(3x0^2+3x0+1) + 6*x0*SI + SQ */
+static void linha_p4(const uint8_t *d, int w, Linha *L) {
+    int nb = (w + 7) / 8;
+    for (int k = 0; k < nb; k++) {
+        uint8_t m = d[k];
+        if (k == nb - 1 && (w & 7)) m &= (uint8_t)(0xFF << (8 - (w & 7)));   /* bits de enchimento */
+        if (!m) continue;
+        uint64_t x0 = 8u * (uint64_t)k, p = POP[m];
+        L->n  += p;
+        L->s1 += p * (2*x0 + 1) + 2u*SI[m];
+        L->s2 += p * (3*x0*x0 + 3*x0 + 1) + 6u*x0*SI[m] + SQ[m];
+
+        int i0 = 0, i1 = 7;
+        while (!(m & (0x80 >> i0))) i0++;
+        while (!(m & (0x80 >> i1))) i1--;
+        if ((int)x0 + i0 < L->x0)     L->x0 = (int)x0 + i0;
+        if ((int)x0 + i1 + 1 > L->x1) L->x1 = (int)x0 + i1 + 1;
+    }
+}
+
+/* P5: corridas de pixels com valor < limiar */
+static void linha_p5(const uint8_t *d, int w, uint8_t limiar, Linha *L) {
+    int x = 0;
+    while (x < w) {
+        while (x < w && d[x] >= limiar) x++;
+        int a = x;
+        while (x < w && d[x] < limiar) x++;
+        if (x > a) corrida(L, a, x);
+    }
+}
+
+/* ======== cabeçalho PBM/PGM ======== */
+
+static int ler_inteiro(uint8_t f) {
+    int c = ti_GetC(f);
+    for (;;) {                       /* espaços e comentários */
+        if (c == '#') {
+            while (c != '\n' && c != EOF) c = ti_GetC(f);
+        } else if (c == ' ' || c == '\t' || c == '\r' || c == '\n') {
+            c = ti_GetC(f);
+        } else break;
+    }
+    int v = 0;
+    if (c < '0' || c > '9') return -1;
+    while (c >= '0' && c <= '9') {
+        v = v*10 + (c - '0');
+        c = ti_GetC(f);
+    }
+    return v;                        /* o separador depois do número já foi lido */
+}
+
+/* AppVars cujo conteúdo começa com "P4" ou "P5"; nomes em nomes[i] (até 8 letras) */
+int bitmap_listar(char nomes[][9], int max) {
+    static const char *const magicos[2] = { "P4", "P5" };
+    int n = 0;
+    for (int t = 0; t < 2; t++) {
+        void *pos = NULL;
+        char *nome;
+        while (n < max && (nome = ti_Detect(&pos, magicos[t])) != NULL) {
+            strncpy(nomes[n], nome, 8);
+            nomes[n][8] = '\0';
+            n++;
+        }
+    }
+    return n;
+}
+
+/* lê a AppVar e devolve os momentos em metros (lado do pixel = tam_pixel).
+   Origem no canto inferior esquerdo da imagem, y para cima. */
+bool bitmap_importar(const char *nome, real_t tam_pixel, SecMomentos *m, BitmapInfo *info) {
+    memset(m, 0, sizeof *m);
+    memset(info, 0, sizeof *info);
+    if (tam_pixel <= 0.0) return false;
+    if (!tabelas_ok) montar_tabelas();
+
+    uint8_t f = ti_Open(nome, "r");
+    if (!f) return false;
+
+    int c0 = ti_GetC(f), c1 = ti_GetC(f);
+    bool p4 = (c0 == 'P' && c1 == '4');
+    bool p5 = (c0 == 'P' && c1 == '5');
+    int w = ler_inteiro(f), h = ler_inteiro(f);
+    int maxval = p5 ? ler_inteiro(f) : 1;
+    int nbytes = p4 ? (w + 7) / 8 : w;
+    if ((!p4 && !p5) || w <= 0 || h <= 0 || maxval <= 0 || maxval > 255 || nbytes > MAX_LINHA) {
+        ti_Close(f);
+        return false;
+    }
+    uint8_t limiar = (uint8_t)((maxval + 1) / 2);
+
+    /* somas exatas em pixels (yb = base da linha, contada de baixo) */
+    uint64_t A = 0, S1 = 0, S2 = 0, Sy2 = 0, Iy3 = 0, Ixy4 = 0;
+    int xmin = w, xmax = 0, ymin = h, ymax = 0;
+
+    for (int j = 0; j < h; j++) {
+        if (ti_Read(linha, 1, nbytes, f) != (size_t)nbytes) {
+            ti_Close(f);
+            return false;
+        }
+        Linha L = { 0, 0, 0, w, 0 };
+        if (p4) linha_p4(linha, w, &L);
+        else    linha_p5(linha, w, limiar, &L);
+        if (!L.n) continue;
+
+        uint64_t yb = (uint64_t)(h - 1 - j);
+        A    += L.n;
+        S1   += L.s1;                          /* 2 * Int x dA   */
+        S2   += L.s2;                          /* 3 * Int x^2 dA */
+        Sy2  += L.n * (2*yb + 1);              /* 2 * Int y dA   */
+        Iy3  += L.n * (3*yb*yb + 3*yb + 1);    /* 3 * Int y^2 dA */
+        Ixy4 += L.s1 * (2*yb + 1);             /* 4 * Int xy dA  */
+        if (L.x0 < xmin) xmin = L.x0;
+        if (L.x1 > xmax) xmax = L.x1;
+        if ((int)yb < ymin) ymin = (int)yb;
+        if ((int)yb + 1 > ymax) ymax = (int)yb + 1;
+    }
+    ti_Close(f);
+    if (!A) return false;
+
+    real_t s = tam_pixel, s2 = s*s, s3 = s2*s, s4 = s3*s;
+    m->A   = (real_t)A * s2;
+    m->Sx  = (real_t)S1 / 2.0 * s3;
+    m->Sy  = (real_t)Sy2 / 2.0 * s3;
+    m->Ixx = (real_t)Iy3 / 3.0 * s4;
+    m->Iyy = (real_t)S2 / 3.0 * s4;
+    m->Ixy = (real_t)Ixy4 / 4.0 * s4;
+    m->xmin = xmin * s; m->xmax = xmax * s;
+    m->ymin = ymin * s; m->ymax = ymax * s;
+
+    info->w = w;
+    info->h = h;
+    info->pixels = (long)A;
+    return true;
+}
@@ -0,0 +1,127 @@
+/*  src/campo.c
+    CAMPO DE TENSOES sig(x, y) = N(x)/A - M(x)*(y - y_bar)/Ix para MECSOL - TI-84 Plus CE
+    Junta os extremos exatos de M(x) (viga.c) com as fibras extremas da
+    seção: em seção assimétrica a tração máxima pode vir do M negativo
+    (fibra de cima), não do |M| máximo. Com força normal, N(x) é constante
+    por trechos e os extremos de M são procurados em cada trecho.
+    A grade densa é separável: N e M uma vez por coluna, fator da fibra
+    uma vez por linha, e cada ponto é um produto e uma soma.
+
+    Autor: https://github.com/daniSoares08
+*/
+
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+
+#include "secao.h"
+
+/* ======== API externa que vem de viga.c ======== */
+real_t viga_get_length(void);
+bool   viga_momento_extremos_em(real_t x0, real_t x1,
+                                real_t *pMmax, real_t *pxmax, real_t *pMmin, real_t *pxmin);
+int    viga_momento_lote(const real_t *xs, real_t *Ms, int n);
+real_t viga_normal_em(real_t x);
+int    viga_normal_trechos(real_t *xs, int maxn);
+
+#define MAX_COLS   128
+#define MAX_TRECHOS 8
+
+static real_t xs[MAX_COLS];
+static real_t Ms[MAX_COLS];
+
+/* tração (sig > 0) e compressão (sig < 0) governantes na viga inteira.
+   y medido da base da seção, como nas outras telas. */
+bool campo_criticos(PontoCritico *tracao, PontoCritico *compressao) {
+    const SecProps *p = centroid_get_props();
+    real_t tr[MAX_TRECHOS];
+    if (!p || p->Ix <= 0.0 || p->A <= 0.0) return false;
+    int nt = viga_normal_trechos(tr, MAX_TRECHOS);
+    if (nt < 2) return false;
+
+    real_t ks = -p->c_sup / p->Ix;   /* sig/M na fibra de cima  */
+    real_t ki =  p->c_inf / p->Ix;   /* sig/M na fibra de baixo */
+    bool achou = false;
+
+    for (int t = 0; t < nt - 1; t++) {
+        real_t Mmax, xmax, Mmin, xmin;
+        if (!viga_momento_extremos_em(tr[t], tr[t+1], &Mmax, &xmax, &Mmin, &xmin)) continue;
+        real_t N  = viga_normal_em(0.5 * (tr[t] + tr[t+1]));   /* constante no trecho */
+        real_t s0 = N / p->A;
+
+        /* 4 combinações {Mmax, Mmin} x {cima, baixo} */
+        PontoCritico c[4] = {
+            { s0 + Mmax * ki, xmax, p->ymin, Mmax, N },
+            { s0 + Mmax * ks, xmax, p->ymax, Mmax, N },
+            { s0 + Mmin * ki, xmin, p->ymin, Mmin, N },
+            { s0 + Mmin * ks, xmin, p->ymax, Mmin, N },
+        };
+        if (!achou) {
+            *tracao = c[0];
+            *compressao = c[0];
+            achou = true;
+        }
+        for (int k = 0; k < 4; k++) {
+            if (c[k].sig > tracao->sig)     *tracao = c[k];
+            if (c[k].sig < compressao->sig) *compressao = c[k];
+        }
+    }
+    return achou;
+}
+
+/* grade nx x ny em [0,L] x [ymin,ymax]; sig[j*nx + i] com j=0 na base.
+   Linhas sem material (vão entre partes) ficam em 0. Devolve nx*ny. */
+int campo_grade(int nx, int ny, float *sig) {
+    const SecProps *p = centroid_get_props();
+    real_t L = viga_get_length();
+    if (!p || p->Ix <= 0.0 || p->A <= 0.0 || L <= 0.0 || nx < 2 || ny < 2) return 0;
+    if (nx > MAX_COLS) nx = MAX_COLS;
+
+    for (int i = 0; i < nx; i++) xs[i] = L * (real_t)i / (real_t)(nx - 1);
+    if (viga_momento_lote(xs, Ms, nx) != nx) return 0;
+    for (int i = 0; i < nx; i++) xs[i] = viga_normal_em(xs[i]) / p->A;   /* xs vira N/A */
+
+    int nr = 0;
+    centroid_get_rects(&nr);            /* seção importada: sem b(y), grade cheia */
+    real_t h = p->ymax - p->ymin;
+    for (int j = 0; j < ny; j++) {
+        real_t y = p->ymin + h * (real_t)j / (real_t)(ny - 1);
+        real_t b = 1.0;
+        if (nr > 0) cisalhamento_Q(y, &b);
+        float *lin = &sig[j * nx];
+        if (b <= 0.0) {
+            memset(lin, 0, nx * sizeof *lin);
+            continue;
+        }
+        real_t k = -(y - p->ybar) / p->Ix;
+        for (int i = 0; i < nx; i++) lin[i] = (float)(xs[i] + Ms[i] * k);
+    }
+    return nx * ny;
+}
+
+/* sig nas fibras extremas e linha neutra para um par (N, M) */
+static void avaliar_NM(const SecProps *p, real_t N, real_t M, TensaoNM *r) {
+    real_t s0 = N / p->A;
+    r->sig_sup = s0 - M * p->c_sup / p->Ix;
+    r->sig_inf = s0 + M * p->c_inf / p->Ix;
+    /* sig = 0 em y = y_bar + N*Ix/(A*M); M = 0 -> sem linha neutra */
+    if (M != 0.0) {
+        r->y_ln = p->ybar + N * p->Ix / (p->A * M);
+        r->ln_na_secao = (r->y_ln >= p->ymin && r->y_ln <= p->ymax);
+    } else {
+        r->y_ln = (N >= 0.0) ? p->ymin : p->ymax;
+        r->ln_na_secao = false;
+    }
+}
+
+/* vários pares (N, M) contra a seção atual; devolve quantos avaliou */
+int campo_NM_lote(const real_t *N, const real_t *M, int n, TensaoNM *out) {
+    const SecProps *p = centroid_get_props();
+    if (!p || p->Ix <= 0.0 || p->A <= 0.0) return 0;
+    for (int i = 0; i < n; i++) avaliar_NM(p, N[i], M[i], &out[i]);
+    return n;
+}
+
+bool campo_NM(real_t N, real_t M, TensaoNM *out) {
+    return campo_NM_lote(&N, &M, 1, out) == 1;
+}
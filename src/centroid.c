@@ -12,30 +12,58 @@
 #include <string.h>
 #include <math.h>
 
+#include "secao.h"
+#include "dual.h"
+#include "tela.h"
+#include "entrada.h"
+
 #define MAX_RECT 12
 #define STRBUF 64
 
-/* Estruturas para retângulos */
-typedef struct { unsigned char rec; double w,h,x0,y0; } Rect;
-typedef struct { double A,cx,cy; } Props;
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+/* Propriedades de um retângulo isolado (Rect vem de secao.h) */
+typedef struct { real_t A,cx,cy; } Props;
 
 /* Dados globais da figura (permanece em memória até ON) */
 static Rect R[MAX_RECT];
 static int N = 0;
-static double xbar = 0.0, ybar = 0.0;
-static double unit_factor = 1.0;   /* multiplicador para converter da unidade escolhida para metro */
+static real_t xbar = 0.0, ybar = 0.0;
+static real_t unit_factor = 1.0;   /* multiplicador para converter da unidade escolhida para metro */
 static const char *unit_name = "m";
 
-typedef struct { double val; const char *unit; } DispVal;
-typedef struct { double factor; const char *name; } UnitOpt;
+/* registro de propriedades da seção (vale até a figura mudar) */
+static SecProps sec_props;
+static bool sec_props_ok = false;
+static bool sec_sobreposicao = false;   /* retângulos se sobrepõem (soma != união) */
+static unsigned sec_revisao = 0;        /* caches dos outros módulos comparam isto */
+
+/* seção importada de bitmap ou desenho (sem retângulos: só os momentos) */
+static bool sec_importada = false;
+static SecMomentos sec_imp;
+static char sec_imp_desc[40];
+static char sec_imp_nome[9];
+
+static void figura_mudou(void) {
+    sec_props_ok = false;
+    sec_revisao++;
+}
+
+typedef struct { real_t val; const char *unit; } DispVal;
+typedef struct { real_t factor; const char *name; } UnitOpt;
 
-static double round_dec(double v, int dec) {
-    double s = pow(10.0, dec);
+/* potências de 10 em tabela: pow() é caro no eZ80 e round_dec roda em todo cálculo */
+static const real_t P10[11] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10 };
+
+static real_t round_dec(real_t v, int dec) {
+    real_t s = (dec >= 0 && dec <= 10) ? P10[dec] : pow(10.0, dec);
     return round(v * s) / s;
 }
 
 /* Seleciona unidade para exibição (mm/cm/m) com base na magnitude, preferindo a unidade escolhida */
-static const UnitOpt *pick_unit(double meters) {
+static const UnitOpt *pick_unit(real_t meters) {
     static const UnitOpt opts[] = {
         {0.001, "mm"},
         {0.01,  "cm"},
@@ -44,12 +72,12 @@ static const UnitOpt *pick_unit(double meters) {
     const UnitOpt *pref = &opts[2]; /* default m */
     for (size_t i=0;i<3;i++) if (fabs(opts[i].factor - unit_factor) < 1e-12) pref = &opts[i];
 
-    const double LOW = 0.01;
-    const double HIGH = 9999.0;
+    const real_t LOW = 0.01;
+    const real_t HIGH = 9999.0;
 
     const UnitOpt *best = pref;
-    double val = (best->factor > 0.0) ? meters / best->factor : meters;
-    double amag = fabs(val);
+    real_t val = (best->factor > 0.0) ? meters / best->factor : meters;
+    real_t amag = fabs(val);
 
     if (amag > HIGH && best->factor < 1.0) {
         if (best->factor < 0.01) best = &opts[1]; else best = &opts[2];
@@ -59,38 +87,38 @@ static const UnitOpt *pick_unit(double meters) {
     return best;
 }
 
-static DispVal disp_len(double meters) {
+static DispVal disp_len(real_t meters) {
     const UnitOpt *u = pick_unit(meters);
-    double v = (u->factor > 0.0) ? meters / u->factor : meters;
+    real_t v = (u->factor > 0.0) ? meters / u->factor : meters;
     return (DispVal){ v, u->name };
 }
 
-static DispVal disp_area(double m2) {
+static DispVal disp_area(real_t m2) {
     const UnitOpt *u = pick_unit(sqrt(fabs(m2)));
-    double f = u->factor;
-    double v = (f > 0.0) ? m2 / (f * f) : m2;
+    real_t f = u->factor;
+    real_t v = (f > 0.0) ? m2 / (f * f) : m2;
     return (DispVal){ v, u->name };
 }
 
-static DispVal disp_m3(double m3) {
+static DispVal disp_m3(real_t m3) {
     const UnitOpt *u = pick_unit(cbrt(fabs(m3)));
-    double f = u->factor;
-    double v = (f > 0.0) ? m3 / (f * f * f) : m3;
+    real_t f = u->factor;
+    real_t v = (f > 0.0) ? m3 / (f * f * f) : m3;
     return (DispVal){ v, u->name };
 }
 
-static DispVal disp_m4(double m4) {
+static DispVal disp_m4(real_t m4) {
     const UnitOpt *u = pick_unit(pow(fabs(m4), 0.25));
-    double f = u->factor;
-    double f2 = f * f;
-    double v = (f > 0.0) ? m4 / (f2 * f2) : m4;
+    real_t f = u->factor;
+    real_t f2 = f * f;
+    real_t v = (f > 0.0) ? m4 / (f2 * f2) : m4;
     return (DispVal){ v, u->name };
 }
 
 /* ======== Teclado / util ======== */
 
 static inline void check_on_exit(void) {
-    kb_Scan();
+    tela_scan();
     if (kb_On) {
         gfx_End();
         exit(0);
@@ -99,9 +127,7 @@ static inline void check_on_exit(void) {
 
 /* espera soltar todas as teclas (evita propagar tecla 4 para o main) */
 static void wait_key_release(void) {
-    do { kb_Scan(); } while (kb_Data[1] | kb_Data[2] | kb_Data[3] |
-                              kb_Data[4] | kb_Data[5] | kb_Data[6] | kb_Data[7]);
-    delay(15);
+    entrada_soltar();
 }
 
 static void set_unit_by_choice(int opt) {
@@ -117,7 +143,7 @@ static uint8_t pressed_once(kb_lkey_t lk) {
     static uint8_t prev_enter=0, prev_clear=0;
     static uint8_t prev0=0, prev1=0, prev2=0, prev3=0, prev4=0;
     static uint8_t prev5=0, prev6=0, prev7=0, prev8=0, prev9=0;
-    static uint8_t prevDot=0, prevNeg=0;
+    static uint8_t prevUp=0, prevDown=0;
     uint8_t *prev=NULL;
     switch(lk) {
         case kb_KeyEnter: prev=&prev_enter; break;
@@ -132,8 +158,8 @@ static uint8_t pressed_once(kb_lkey_t lk) {
         case kb_Key7: prev=&prev7; break;
         case kb_Key8: prev=&prev8; break;
         case kb_Key9: prev=&prev9; break;
-        case kb_KeyDecPnt: prev=&prevDot; break;
-        case kb_KeyChs: prev=&prevNeg; break;
+        case kb_KeyUp: prev=&prevUp; break;
+        case kb_KeyDown: prev=&prevDown; break;
         default: return 0;
     }
     uint8_t down = kb_IsDown(lk) ? 1 : 0;
@@ -144,7 +170,7 @@ static uint8_t pressed_once(kb_lkey_t lk) {
 
 /* pergunta unidade (mm/cm/m) e ajusta fator para salvar em metros */
 static void selecionar_unidade(void) {
-    gfx_FillScreen(0);
+    tela_limpar();
     gfx_SetTextFGColor(1);
     gfx_PrintStringXY("Unidade das entradas:", 2, 2);
     gfx_PrintStringXY("1) mm", 2, 18);
@@ -154,54 +180,25 @@ static void selecionar_unidade(void) {
 
     while (1) {
         check_on_exit();
-        kb_Scan();
+        tela_scan();
         if (pressed_once(kb_Key1)) { set_unit_by_choice(1); break; }
         if (pressed_once(kb_Key2)) { set_unit_by_choice(2); break; }
         if (pressed_once(kb_Key3) || pressed_once(kb_KeyEnter)) { set_unit_by_choice(3); break; }
         if (pressed_once(kb_KeyClear)) { break; }
-        delay(10);
+        entrada_dormir();
     }
     wait_key_release();
 }
 
-/* input_line (teclado estilo CENTROID no rascunho) */
+/* input_line: tela própria com prompt; o editor é o de entrada.c */
 static void input_line(char *buf, int maxlen, const char *prompt){
-    int idx=0; buf[0]='\0';
-    bool dirty = true;
-
-    gfx_FillScreen(0);              /* fundo branco (desenha uma vez) */
+    tela_limpar();              /* fundo branco (desenha uma vez) */
     gfx_SetTextFGColor(1);          /* texto preto */
     gfx_PrintStringXY(prompt, 2, 2);
     gfx_PrintStringXY("ENTER=ok CLEAR=apaga ON=sair", 2, 78);
-    for(;;){
-        check_on_exit();
-        kb_Scan();
-        if (dirty) {
-            gfx_SetColor(0);
-            gfx_FillRectangle(0, 18, 320, 12); /* limpa só a linha do buffer */
-            gfx_SetTextFGColor(1);
-            gfx_PrintStringXY(buf, 2, 18);
-            dirty = false;
-        }
-
-        if (pressed_once(kb_KeyEnter)) { buf[idx]='\0'; return; }
-        if (pressed_once(kb_KeyClear)) { if (idx>0){ idx--; buf[idx]='\0'; dirty = true; } }
-        if (pressed_once(kb_Key0) && idx<maxlen-1){ buf[idx++]='0'; buf[idx]='\0'; dirty = true; }
-        if (pressed_once(kb_Key1) && idx<maxlen-1){ buf[idx++]='1'; buf[idx]='\0'; dirty = true; }
-        if (pressed_once(kb_Key2) && idx<maxlen-1){ buf[idx++]='2'; buf[idx]='\0'; dirty = true; }
-        if (pressed_once(kb_Key3) && idx<maxlen-1){ buf[idx++]='3'; buf[idx]='\0'; dirty = true; }
-        if (pressed_once(kb_Key4) && idx<maxlen-1){ buf[idx++]='4'; buf[idx]='\0'; dirty = true; }
-        if (pressed_once(kb_Key5) && idx<maxlen-1){ buf[idx++]='5'; buf[idx]='\0'; dirty = true; }
-        if (pressed_once(kb_Key6) && idx<maxlen-1){ buf[idx++]='6'; buf[idx]='\0'; dirty = true; }
-        if (pressed_once(kb_Key7) && idx<maxlen-1){ buf[idx++]='7'; buf[idx]='\0'; dirty = true; }
-        if (pressed_once(kb_Key8) && idx<maxlen-1){ buf[idx++]='8'; buf[idx]='\0'; dirty = true; }
-        if (pressed_once(kb_Key9) && idx<maxlen-1){ buf[idx++]='9'; buf[idx]='\0'; dirty = true; }
-        if (pressed_once(kb_KeyDecPnt) && idx<maxlen-1){ buf[idx++]='.'; buf[idx]='\0'; dirty = true; }
-        if (pressed_once(kb_KeyChs)    && idx<maxlen-1){ buf[idx++]='-'; buf[idx]='\0'; dirty = true; }
-        delay(10);
-    }
-}
-static double input_double(const char *prompt){
+    entrada_linha(buf, maxlen, 2, 18, 316);
+}
+static real_t input_double(const char *prompt){
     char s[STRBUF]; input_line(s, STRBUF, prompt);
     for (int i=0; s[i]; ++i) if (s[i] == ',') s[i] = '.';
     return atof(s);
@@ -274,9 +271,94 @@ static Props props(const Rect *r) {
     return p;
 }
 
+/* Uma passada sobre os retângulos: A, Sx, Sy, Ixx, Iyy, Ixy em torno da origem.
+   Cada retângulo entra com sinal (recorte subtrai), igual calc_centroid/calc_Ix. */
+static void momentos_retangulos(const Rect *r, int n, SecMomentos *m) {
+    memset(m, 0, sizeof *m);
+    m->xmin = m->ymin = 1e9;
+    m->xmax = m->ymax = -1e9;
+
+    for (int i = 0; i < n; ++i) {
+        real_t s  = r[i].rec ? -1.0 : 1.0;
+        real_t w  = r[i].w, h = r[i].h;
+        real_t A  = s * w * h;
+        real_t cx = r[i].x0 + w/2.0;
+        real_t cy = r[i].y0 + h/2.0;
+
+        m->A   += A;
+        m->Sx  += A * cx;
+        m->Sy  += A * cy;
+        m->Ixx += s * w*h*h*h/12.0 + A * cy*cy;   /* Ixc + A*cy^2 */
+        m->Iyy += s * h*w*w*w/12.0 + A * cx*cx;   /* Iyc + A*cx^2 */
+        m->Ixy += A * cx * cy;                    /* Ixyc = 0 no retângulo */
+
+        if (r[i].x0 < m->xmin)       m->xmin = r[i].x0;
+        if (r[i].x0 + w > m->xmax)   m->xmax = r[i].x0 + w;
+        if (r[i].y0 < m->ymin)       m->ymin = r[i].y0;
+        if (r[i].y0 + h > m->ymax)   m->ymax = r[i].y0 + h;
+    }
+}
+
+void secao_props_de_momentos(const SecMomentos *m, SecProps *p) {
+    memset(p, 0, sizeof *p);
+    p->A = m->A;
+    p->xmin = m->xmin; p->xmax = m->xmax;
+    p->ymin = m->ymin; p->ymax = m->ymax;
+    if (m->A == 0.0) return;
+
+    p->xbar = m->Sx / m->A;
+    p->ybar = m->Sy / m->A;
+
+    /* eixos paralelos: leva da origem para o centroide */
+    p->Ix  = m->Ixx - m->A * p->ybar * p->ybar;
+    p->Iy  = m->Iyy - m->A * p->xbar * p->xbar;
+    p->Ixy = m->Ixy - m->A * p->xbar * p->ybar;
+
+    /* Mohr: I1,2 = (Ix+Iy)/2 +- sqrt(((Ix-Iy)/2)^2 + Ixy^2) */
+    real_t med = 0.5 * (p->Ix + p->Iy);
+    real_t dif = 0.5 * (p->Ix - p->Iy);
+    real_t raio = sqrt(dif*dif + p->Ixy*p->Ixy);
+    p->I1 = med + raio;
+    p->I2 = med - raio;
+    p->theta_p = (raio > 0.0) ? 0.5 * atan2(-p->Ixy, dif) : 0.0;
+
+    p->c_sup = p->ymax - p->ybar;
+    p->c_inf = p->ybar - p->ymin;
+    p->S_sup = (p->c_sup > 0.0) ? p->Ix / p->c_sup : 0.0;
+    p->S_inf = (p->c_inf > 0.0) ? p->Ix / p->c_inf : 0.0;
+
+    p->rx = (p->Ix > 0.0 && p->A > 0.0) ? sqrt(p->Ix / p->A) : 0.0;
+    p->ry = (p->Iy > 0.0 && p->A > 0.0) ? sqrt(p->Iy / p->A) : 0.0;
+}
+
+real_t secao_I_eixo(const SecProps *p, real_t theta) {
+    real_t c2 = cos(2.0*theta), s2 = sin(2.0*theta);
+    return 0.5*(p->Ix + p->Iy) + 0.5*(p->Ix - p->Iy)*c2 - p->Ixy*s2;
+}
+
+/* recalcula o registro só quando a figura mudou.
+   Os momentos vêm da varredura da união (uniao.c); a soma com sinal serve
+   só para avisar quando os retângulos se sobrepõem. */
+static const SecProps *atualizar_props(void) {
+    if (!sec_props_ok && sec_importada) {
+        secao_props_de_momentos(&sec_imp, &sec_props);
+        sec_sobreposicao = false;
+        sec_props_ok = true;
+    }
+    if (!sec_props_ok) {
+        SecMomentos m, soma;
+        uniao_momentos(R, N, &m);
+        momentos_retangulos(R, N, &soma);
+        sec_sobreposicao = fabs(soma.A - m.A) > 1e-9 * (fabs(m.A) + 1e-12);
+        secao_props_de_momentos(&m, &sec_props);
+        sec_props_ok = true;
+    }
+    return &sec_props;
+}
+
 /* tela introdutória para as fórmulas (mostra frações genéricas) */
 static void tela_formula_centroide(void) {
-    gfx_FillScreen(0);
+    tela_limpar();
     gfx_SetTextFGColor(1);
     gfx_PrintStringXY("CENTROIDE (retangulos)", 2, 2);
 
@@ -293,7 +375,7 @@ static void tela_formula_centroide(void) {
 
 /* tela introdutória para Ix */
 static void tela_formula_ix(void) {
-    gfx_FillScreen(0);
+    tela_limpar();
     gfx_SetTextFGColor(1);
     gfx_PrintStringXY("INERCIA Ix (eixo x)", 2, 2);
 
@@ -321,12 +403,12 @@ static void tela_formula_ix(void) {
 }
 
 /* Mostra um resumo numerico da conta do centroide (A_i, x_i, y_i, somas) */
-static bool show_centroid_summary(double SA, double SAx, double SAy,
-                                  const double *Ai,
-                                  const double *cxi,
-                                  const double *cyi,
+static bool show_centroid_summary(real_t SA, real_t SAx, real_t SAy,
+                                  const real_t *Ai,
+                                  const real_t *cxi,
+                                  const real_t *cyi,
                                   int n) {
-    gfx_FillScreen(0);
+    tela_limpar();
     gfx_SetTextFGColor(1);
 
     gfx_PrintStringXY("CENTROIDE - resumo numerico", 2, 2);
@@ -374,30 +456,30 @@ static bool show_centroid_summary(double SA, double SAx, double SAy,
 
     while (1) {
         check_on_exit();
-        kb_Scan();
+        tela_scan();
         if (pressed_once(kb_KeyEnter)) return true;
         if (pressed_once(kb_KeyClear)) return false;
-        delay(10);
+        entrada_dormir();
     }
 }
 
 /* calcula centroide; se show!=0, mostra passo a passo em telas */
 static void calc_centroid(int show) {
-    double SA  = 0.0, SAx = 0.0, SAy = 0.0;
+    real_t SA  = 0.0, SAx = 0.0, SAy = 0.0;
 
     /* para poder montar o resumo tipo tabela */
-    double Ai[MAX_RECT];
-    double cxi[MAX_RECT];
-    double cyi[MAX_RECT];
+    real_t Ai[MAX_RECT];
+    real_t cxi[MAX_RECT];
+    real_t cyi[MAX_RECT];
 
     if (show) {
         tela_formula_centroide();
         while (1) {
             check_on_exit();
-            kb_Scan();
+            tela_scan();
             if (pressed_once(kb_KeyEnter)) break;
             if (pressed_once(kb_KeyClear)) return;
-            delay(10);
+            entrada_dormir();
         }
     }
 
@@ -413,7 +495,7 @@ static void calc_centroid(int show) {
         cyi[i] = q.cy;
 
         if (show) {
-            gfx_FillScreen(0);
+            tela_limpar();
             gfx_SetTextFGColor(1);
             char buf[64];
 
@@ -442,10 +524,10 @@ static void calc_centroid(int show) {
             gfx_PrintStringXY("ENTER=proximo  CLEAR=voltar", 2, 100);
             while (1) {
                 check_on_exit();
-                kb_Scan();
+                tela_scan();
                 if (pressed_once(kb_KeyEnter)) break;
                 if (pressed_once(kb_KeyClear)) return;
-                delay(10);
+                entrada_dormir();
             }
         }
     }
@@ -466,7 +548,7 @@ static void calc_centroid(int show) {
             return;
 
         /* 2) tela final com a fracao pronta (resultado) */
-        gfx_FillScreen(0);
+        tela_limpar();
         gfx_SetTextFGColor(1);
         char num[32], den[32];
 
@@ -493,46 +575,53 @@ static void calc_centroid(int show) {
                 dybar.val, dybar.unit);
         gfx_PrintStringXY(buf, 2, 140);
 
+        if (centroid_tem_sobreposicao()) {
+            gfx_SetTextFGColor(2);
+            gfx_PrintStringXY("Obs: retangulos sobrepostos (soma simples).", 2, 176);
+            gfx_PrintStringXY("Uniao exata em 6) Propriedades.", 2, 188);
+            gfx_SetTextFGColor(1);
+        }
+
         gfx_PrintStringXY("ENTER=ok", 2, 160);
         while (!pressed_once(kb_KeyEnter)) {
             check_on_exit();
-            kb_Scan();
-            delay(10);
+            tela_scan();
+            entrada_dormir();
         }
     }
 }
 
 /* calcula Ix; se show!=0, exibe passo a passo */
-static double calc_Ix(int show) {
-    double Ix = 0.0;
-    double termos[MAX_RECT];  /* termo_i = Ixc_i + A_i*dy_i^2 */
+static real_t calc_Ix(int show) {
+    real_t Ix = 0.0;
+    real_t termos[MAX_RECT];  /* termo_i = Ixc_i + A_i*dy_i^2 */
 
     if (show) {
         tela_formula_ix();
         while (1) {
             check_on_exit();
-            kb_Scan();
+            tela_scan();
             if (pressed_once(kb_KeyEnter)) break;
             if (pressed_once(kb_KeyClear)) return 0.0;
-            delay(10);
+            entrada_dormir();
         }
     }
 
     for (int i = 0; i < N; i++) {
         Props q = props(&R[i]);
 
-        double Ixc_mag = round_dec((R[i].w * pow(R[i].h, 3)) / 12.0, 10);
-        double Ixc     = R[i].rec ? -Ixc_mag : Ixc_mag;
+        real_t Ixc_mag = round_dec((R[i].w * pow(R[i].h, 3)) / 12.0, 10);
+        real_t Ixc     = R[i].rec ? -Ixc_mag : Ixc_mag;
 
-        double dy   = round_dec(fabs(q.cy - ybar), 10);
-        double Ady2 = round_dec(q.A * dy * dy, 10);
-        double term = round_dec(Ixc + Ady2, 10);
+        real_t dy   = round_dec(fabs(q.cy - ybar), 10);
+        real_t Ady2 = round_dec(q.A * dy * dy, 10);
+        real_t term = round_dec(Ixc + Ady2, 10);
 
         Ix         += term;
         termos[i]   = term;
 
         if (show) {
-            gfx_FillScreen(0);
+            tela_limpar();
             gfx_SetTextFGColor(1);
             char buf[64];
 
@@ -568,10 +657,10 @@ static double calc_Ix(int show) {
             gfx_PrintStringXY("ENTER=proximo  CLEAR=voltar", 2, 100);
             while (1) {
                 check_on_exit();
-                kb_Scan();
+                tela_scan();
                 if (pressed_once(kb_KeyEnter)) break;
                 if (pressed_once(kb_KeyClear)) return Ix;
-                delay(10);
+                entrada_dormir();
             }
         }
     }
@@ -580,7 +669,7 @@ static double calc_Ix(int show) {
 
     if (show) {
         /* tela final: soma dos termos, parecido com o slide */
-        gfx_FillScreen(0);
+        tela_limpar();
         gfx_SetTextFGColor(1);
         gfx_PrintStringXY("INERCIA Ix - resumo", 2, 2);
 
@@ -602,8 +691,8 @@ static double calc_Ix(int show) {
         gfx_PrintStringXY("ENTER=ok", 2, 210);
         while (!pressed_once(kb_KeyEnter)) {
             check_on_exit();
-            kb_Scan();
-            delay(10);
+            tela_scan();
+            entrada_dormir();
         }
     }
 
@@ -622,6 +711,14 @@ static void desenhar_secao_preview(void) {
 
     gfx_SetColor(1); /* preto */
 
+    if (sec_importada) {
+        char tmp[64];
+        sprintf(tmp, "Secao importada: %s", sec_imp_nome);
+        gfx_PrintStringXY(tmp, x0, y0 + 10);
+        gfx_PrintStringXY(sec_imp_desc, x0, y0 + 22);
+        return;
+    }
+
     /* se nenhuma figura, escreve aviso */
     if (N == 0) {
         gfx_PrintStringXY("Nenhuma figura definida.", x0, y0 + 10);
@@ -629,12 +726,12 @@ static void desenhar_secao_preview(void) {
     }
 
     /* encontra bounding box da geometria (em unidades usadas: x/y dos retângulos) */
-    double minx = 1e9, maxx = -1e9, miny = 1e9, maxy = -1e9;
+    real_t minx = 1e9, maxx = -1e9, miny = 1e9, maxy = -1e9;
     for (int i = 0; i < N; ++i) {
-        double rx0 = R[i].x0;
-        double rx1 = R[i].x0 + R[i].w;
-        double ry0 = R[i].y0;
-        double ry1 = R[i].y0 + R[i].h;
+        real_t rx0 = R[i].x0;
+        real_t rx1 = R[i].x0 + R[i].w;
+        real_t ry0 = R[i].y0;
+        real_t ry1 = R[i].y0 + R[i].h;
         if (rx0 < minx) minx = rx0;
         if (rx1 > maxx) maxx = rx1;
         if (ry0 < miny) miny = ry0;
@@ -643,19 +740,19 @@ static void desenhar_secao_preview(void) {
     if (minx >= maxx) { minx -= 1.0; maxx += 1.0; }
     if (miny >= maxy) { miny -= 1.0; maxy += 1.0; }
 
-    double width = maxx - minx;
-    double height = maxy - miny;
+    real_t width = maxx - minx;
+    real_t height = maxy - miny;
 
     /* escala uniforme com padding */
-    double pad = 6.0;
-    double sx = (w - 2*pad) / width;
-    double sy = (h - 2*pad) / height;
-    double s = (sx < sy) ? sx : sy;
+    real_t pad = 6.0;
+    real_t sx = (w - 2*pad) / width;
+    real_t sy = (h - 2*pad) / height;
+    real_t s = (sx < sy) ? sx : sy;
     if (s <= 0) s = 1.0;
 
     /* origem em pixels para posicionar (centraliza) */
-    double px0 = x0 + pad + (w - 2*pad - s*width)/2.0;
-    double py0 = y0 + pad + (h - 2*pad - s*height)/2.0;
+    real_t px0 = x0 + pad + (w - 2*pad - s*width)/2.0;
+    real_t py0 = y0 + pad + (h - 2*pad - s*height)/2.0;
 
     /* desenha fundo da área */
     gfx_SetColor(0);
@@ -696,10 +793,12 @@ static void desenhar_secao_preview(void) {
 static void tela_construir(void) {
     memset(R, 0, sizeof(R));
     N = 0;
+    sec_importada = false;
+    figura_mudou();
 
     selecionar_unidade(); /* escolhe mm/cm/m antes de entrar com dados */
 
-    gfx_FillScreen(0);
+    tela_limpar();
     gfx_SetTextFGColor(1);
     char info[64];
     snprintf(info, sizeof info, "FIGURA: retangulos (0,0) na base [%s]", unit_name);
@@ -723,12 +822,13 @@ static void tela_construir(void) {
         R[N].y0 = round_dec(input_double(t) * unit_factor, 10);
         R[N].rec = 0;
         N++;
+        figura_mudou();
         /* mostrar preview entre entradas */
-        gfx_FillScreen(0);
+        tela_limpar();
         gfx_PrintStringXY("Preview:", 2, 56);
         desenhar_secao_preview();
         gfx_PrintStringXY("ENTER=continuar CLEAR=cancelar", 2, 206);
-        while (1) { check_on_exit(); kb_Scan(); if (pressed_once(kb_KeyEnter)) break; if (pressed_once(kb_KeyClear)) return; }
+        while (1) { check_on_exit(); tela_scan(); if (pressed_once(kb_KeyEnter)) break; if (pressed_once(kb_KeyClear)) return; entrada_dormir(); }
     }
     for (int i = 0; i < nR; ++i) {
         char t[STRBUF];
@@ -742,11 +842,12 @@ static void tela_construir(void) {
         R[N].y0 = round_dec(input_double(t) * unit_factor, 10);
         R[N].rec = 1;
         N++;
-        gfx_FillScreen(0);
+        figura_mudou();
+        tela_limpar();
         gfx_PrintStringXY("Preview:", 2, 56);
         desenhar_secao_preview();
         gfx_PrintStringXY("ENTER=continuar CLEAR=cancelar", 2, 206);
-        while (1) { check_on_exit(); kb_Scan(); if (pressed_once(kb_KeyEnter)) break; if (pressed_once(kb_KeyClear)) return; }
+        while (1) { check_on_exit(); tela_scan(); if (pressed_once(kb_KeyEnter)) break; if (pressed_once(kb_KeyClear)) return; entrada_dormir(); }
     }
 
     /* calcula xbar/ybar sem mostrar passos */
@@ -755,52 +856,109 @@ static void tela_construir(void) {
 
 /* ======== API P/ MODULO (MAX. TENSOES) ======== */
 
-/* retorna 1 se existir pelo menos um retangulo definido */
+/* retorna 1 se existir pelo menos um retangulo definido (ou seção importada) */
 int centroid_has_figure(void) {
-    return (N > 0);
+    return (N > 0 || sec_importada);
 }
 
-/* devolve x_bar e y_bar em METROS (recalcula rapido, sem telas) */
-void centroid_get_centroid(double *px, double *py) {
-    if (N <= 0) {
+/* devolve x_bar e y_bar em METROS (lê do registro de propriedades) */
+void centroid_get_centroid(real_t *px, real_t *py) {
+    if (!centroid_has_figure()) {
         if (px) *px = 0.0;
         if (py) *py = 0.0;
         return;
     }
-    /* garante xbar/ybar atualizados */
-    calc_centroid(0);
-
-    if (px) *px = round_dec(xbar, 8);
-    if (py) *py = round_dec(ybar, 8);
+    const SecProps *p = atualizar_props();
+    if (px) *px = round_dec(p->xbar, 8);
+    if (py) *py = round_dec(p->ybar, 8);
 }
 
-/* devolve Ix em m^4 (recalcula silenciosamente se preciso) */
-double centroid_get_Ix(void) {
-    if (N <= 0) return 0.0;
-
-    /* assegura ybar correto antes de calcular Ix */
-    calc_centroid(0);
-    return round_dec(calc_Ix(0), 8);
+/* devolve Ix em m^4 (eixo x centroidal) */
+real_t centroid_get_Ix(void) {
+    if (!centroid_has_figure()) return 0.0;
+    return round_dec(atualizar_props()->Ix, 8);
 }
 
 /* limites inferiores/superiores em y (em METROS, sistema interno) */
-void centroid_get_y_bounds(double *pymin, double *pymax) {
-    if (N <= 0) {
+void centroid_get_y_bounds(real_t *pymin, real_t *pymax) {
+    if (!centroid_has_figure()) {
         if (pymin) *pymin = 0.0;
         if (pymax) *pymax = 0.0;
         return;
     }
+    const SecProps *p = atualizar_props();
+    if (pymin) *pymin = round_dec(p->ymin, 8);
+    if (pymax) *pymax = round_dec(p->ymax, 8);
+}
 
-    double miny = 1e9, maxy = -1e9;
-    for (int i = 0; i < N; ++i) {
-        double y0 = R[i].y0;
-        double y1 = R[i].y0 + R[i].h;
-        if (y0 < miny) miny = y0;
-        if (y1 > maxy) maxy = y1;
-    }
+/* registro completo (A, Ix, Iy, Ixy, principais, S, r); NULL sem figura */
+const SecProps *centroid_get_props(void) {
+    if (!centroid_has_figure()) return NULL;
+    return atualizar_props();
+}
+
+/* retângulos da figura (em metros) para os módulos de cálculo */
+const Rect *centroid_get_rects(int *pn) {
+    if (pn) *pn = N;
+    return R;
+}
+
+unsigned centroid_get_revisao(void) {
+    return sec_revisao;
+}
+
+/* troca a figura por um perfil do catálogo (entra em mm) */
+void centroid_carregar_perfil(const Perfil *p) {
+    memset(R, 0, sizeof(R));
+    sec_importada = false;
+    N = perfis_retangulos(p, R);
+    set_unit_by_choice(1);
+    figura_mudou();
+    calc_centroid(0);
+}
+
+/* 1 se a soma com sinal dos retângulos difere da área da união */
+int centroid_tem_sobreposicao(void) {
+    if (N <= 0) return 0;
+    atualizar_props();
+    return sec_sobreposicao;
+}
 
-    if (pymin) *pymin = round_dec(miny, 8);
-    if (pymax) *pymax = round_dec(maxy, 8);
+/* A, y_bar, Ix, c_sup, c_inf em números duais: a mesma soma com sinal de
+   momentos_retangulos, com b/h do retângulo i como variáveis. Sem
+   sobreposição a soma é a união, então as derivadas valem para ela. */
+bool centroid_props_dual(int i, int slot_b, int slot_h, SecDual *s) {
+    if (N <= 0 || i < 0 || i >= N || centroid_tem_sobreposicao()) return false;
+
+    Dual A = dual_c(0.0), Sy = dual_c(0.0), Ixx = dual_c(0.0);
+    Dual ymin = dual_c(1e9), ymax = dual_c(-1e9);
+    for (int k = 0; k < N; ++k) {
+        real_t sg = R[k].rec ? -1.0 : 1.0;
+        Dual w  = dual_var(R[k].w, k == i ? slot_b : -1);
+        Dual h  = dual_var(R[k].h, k == i ? slot_h : -1);
+        Dual y0 = dual_c(R[k].y0);
+        Dual Ak = dual_esc(dual_mul(w, h), sg);
+        Dual cy = dual_add(y0, dual_esc(h, 0.5));
+        Dual h3 = dual_mul(h, dual_mul(h, h));
+
+        A   = dual_add(A, Ak);
+        Sy  = dual_add(Sy, dual_mul(Ak, cy));
+        Ixx = dual_add(Ixx, dual_add(dual_esc(dual_mul(w, h3), sg / 12.0),
+                                     dual_mul(Ak, dual_mul(cy, cy))));
+        if (!R[k].rec) {
+            Dual topo = dual_add(y0, h);
+            if (topo.v > ymax.v) ymax = topo;
+            if (y0.v < ymin.v)   ymin = y0;
+        }
+    }
+    if (fabs(A.v) < 1e-15) return false;
+
+    s->A     = A;
+    s->ybar  = dual_div(Sy, A);
+    s->Ix    = dual_sub(Ixx, dual_mul(A, dual_mul(s->ybar, s->ybar)));
+    s->c_sup = dual_sub(ymax, s->ybar);
+    s->c_inf = dual_sub(s->ybar, ymin);
+    return true;
 }
 
 /* unidade usada na figura ("mm", "cm" ou "m") */
@@ -809,28 +967,341 @@ const char *centroid_get_unit_name(void) {
 }
 
 /* fator p/ converter UNIDADE -> metro (mesmo usado internamente) */
-double centroid_get_unit_factor(void) {
+real_t centroid_get_unit_factor(void) {
     return unit_factor;
 }
 
 
+/* ======== Tela de propriedades (registro completo) ======== */
+static void tela_propriedades(void) {
+    tela_limpar();
+    gfx_SetTextFGColor(1);
+    gfx_PrintStringXY("PROPRIEDADES DA SECAO", 2, 2);
+
+    const SecProps *p = centroid_get_props();
+    if (!p || p->A == 0.0) {
+        gfx_PrintStringXY("Area nula: sem propriedades.", 2, 24);
+    } else {
+        char buf[64];
+        int y = 20;
+        DispVal a = disp_area(p->A);
+        sprintf(buf, "A = %.3f %s^2", a.val, a.unit);
+        gfx_PrintStringXY(buf, 2, y); y += 12;
+
+        DispVal dx = disp_len(p->xbar), dy = disp_len(p->ybar);
+        sprintf(buf, "x_bar=%.3f %s  y_bar=%.3f %s", dx.val, dx.unit, dy.val, dy.unit);
+        gfx_PrintStringXY(buf, 2, y); y += 16;
+
+        DispVal ix = disp_m4(p->Ix), iy = disp_m4(p->Iy), ixy = disp_m4(p->Ixy);
+        sprintf(buf, "Ix  = %.3f %s^4", ix.val, ix.unit);
+        gfx_PrintStringXY(buf, 2, y); y += 12;
+        sprintf(buf, "Iy  = %.3f %s^4", iy.val, iy.unit);
+        gfx_PrintStringXY(buf, 2, y); y += 12;
+        sprintf(buf, "Ixy = %.3f %s^4", ixy.val, ixy.unit);
+        gfx_PrintStringXY(buf, 2, y); y += 16;
+
+        DispVal i1 = disp_m4(p->I1), i2 = disp_m4(p->I2);
+        sprintf(buf, "I1 = %.3f %s^4  I2 = %.3f %s^4", i1.val, i1.unit, i2.val, i2.unit);
+        gfx_PrintStringXY(buf, 2, y); y += 12;
+        sprintf(buf, "theta_p = %.2f graus (eixo de I1)", p->theta_p * 180.0 / M_PI);
+        gfx_PrintStringXY(buf, 2, y); y += 16;
+
+        DispVal cs = disp_len(p->c_sup), ci = disp_len(p->c_inf);
+        sprintf(buf, "c_sup=%.3f %s  c_inf=%.3f %s", cs.val, cs.unit, ci.val, ci.unit);
+        gfx_PrintStringXY(buf, 2, y); y += 12;
+        DispVal ss = disp_m3(p->S_sup), si = disp_m3(p->S_inf);
+        sprintf(buf, "S_sup=%.3f %s^3  S_inf=%.3f %s^3", ss.val, ss.unit, si.val, si.unit);
+        gfx_PrintStringXY(buf, 2, y); y += 16;
+
+        DispVal rx = disp_len(p->rx), ry = disp_len(p->ry);
+        sprintf(buf, "rx=%.3f %s  ry=%.3f %s", rx.val, rx.unit, ry.val, ry.unit);
+        gfx_PrintStringXY(buf, 2, y);
+
+        if (sec_sobreposicao) {
+            gfx_SetTextFGColor(2);
+            gfx_PrintStringXY("Obs: sobreposicao -> usando uniao exata", 2, 196);
+            gfx_SetTextFGColor(1);
+        }
+    }
+
+    gfx_PrintStringXY("ENTER/CLEAR: voltar", 2, 210);
+    while (1) {
+        check_on_exit();
+        tela_scan();
+        if (pressed_once(kb_KeyEnter) || pressed_once(kb_KeyClear)) break;
+        entrada_dormir();
+    }
+    wait_key_release();
+}
+
+/* ======== Tela plástica (LNP, Z e interação N-M) ======== */
+static void tela_plastico(void) {
+    tela_limpar();
+    gfx_SetTextFGColor(1);
+    gfx_PrintStringXY("PLASTICO - LNP e modulo Z", 2, 2);
+
+    real_t yp, Z;
+    const SecProps *p = centroid_get_props();
+    if (!p || !plastico_calcular(&yp, &Z)) {
+        gfx_PrintStringXY("Area nula: sem propriedades.", 2, 24);
+    } else {
+        char buf[64];
+        DispVal dyp = disp_len(yp);
+        sprintf(buf, "y_p (LNP, da base) = %.3f %s", dyp.val, dyp.unit);
+        gfx_PrintStringXY(buf, 2, 20);
+        DispVal dZ = disp_m3(Z);
+        sprintf(buf, "Z = %.3f %s^3   (Mp = fy*Z)", dZ.val, dZ.unit);
+        gfx_PrintStringXY(buf, 2, 32);
+        real_t S = fmin(p->S_sup, p->S_inf);
+        if (S > 0.0) {
+            sprintf(buf, "fator de forma Z/S_min = %.3f", Z / S);
+            gfx_PrintStringXY(buf, 2, 44);
+        }
+
+        /* curva de interação normalizada: N/Np (vertical) x M/Mp (horizontal) */
+        enum { NPT = 33 };
+        real_t Ns[NPT], Ms[NPT];
+        int n = plastico_curva(1.0, NPT, Ns, Ms);
+        const int gx0 = 60, gx1 = 260, gy0 = 70, gy1 = 200;
+        const int cx = (gx0 + gx1) / 2, cy = (gy0 + gy1) / 2;
+        real_t Np = plastico_area_total();
+        real_t Mp = Z;
+
+        gfx_PrintStringXY("Interacao N-M (plastica):", 2, 58);
+        gfx_SetColor(1);
+        gfx_HorizLine(gx0, cy, gx1 - gx0);
+        gfx_VertLine(cx, gy0, gy1 - gy0);
+        gfx_PrintStringXY("M/Mp", gx1 + 4, cy - 4);
+        gfx_PrintStringXY("N/Np", cx + 4, gy0);
+
+        gfx_SetColor(2);
+        for (int i = 1; i < n && Np > 0.0 && Mp > 0.0; i++) {
+            for (int s = -1; s <= 1; s += 2) {     /* espelha para M < 0 */
+                int x0 = cx + (int)(s * Ms[i-1] / Mp * (gx1 - cx));
+                int y0 = cy - (int)(Ns[i-1] / Np * (cy - gy0));
+                int x1 = cx + (int)(s * Ms[i]   / Mp * (gx1 - cx));
+                int y1 = cy - (int)(Ns[i]   / Np * (cy - gy0));
+                gfx_Line(x0, y0, x1, y1);
+            }
+        }
+        gfx_SetColor(1);
+    }
+
+    gfx_PrintStringXY("ENTER/CLEAR: voltar", 2, 210);
+    while (1) {
+        check_on_exit();
+        tela_scan();
+        if (pressed_once(kb_KeyEnter) || pressed_once(kb_KeyClear)) break;
+        entrada_dormir();
+    }
+    wait_key_release();
+}
+
+/* ======== Catálogo de perfis ======== */
+/* lista rolável; ordem por nome / S / peso; ENTER carrega como figura */
+static void tela_catalogo(void) {
+    static const char *ORDENS[] = { "nome", "S", "peso" };
+    const int VIS = 11;              /* linhas visíveis */
+    int ordem = 0, sel = 0, topo = 0;
+    int total = perfis_total();
+
+    wait_key_release();
+    for (;;) {
+        if (sel < topo) topo = sel;
+        if (sel >= topo + VIS) topo = sel - VIS + 1;
+
+        tela_limpar();
+        gfx_SetTextFGColor(1);
+        char buf[64];
+        sprintf(buf, "CATALOGO DE PERFIS  (ordem: %s)", ORDENS[ordem]);
+        gfx_PrintStringXY(buf, 2, 2);
+
+        for (int r = 0; r < VIS && topo + r < total; r++) {
+            int k = topo + r;
+            const Perfil *p = (ordem == 0) ? perfis_get(k)
+                            : (ordem == 1) ? perfis_por_S(k) : perfis_por_peso(k);
+            DispVal dS = disp_m3(p->S);
+            sprintf(buf, "%-10s S=%.1f %s^3  %.1f kg/m", p->nome, dS.val, dS.unit, p->massa);
+            int y = 16 + r * 11;
+            if (k == sel) {
+                gfx_SetColor(1);
+                gfx_FillRectangle(0, y - 1, 320, 10);
+                gfx_SetTextFGColor(0);
+                gfx_SetTextTransparentColor(1);
+                gfx_SetTextBGColor(1);
+            }
+            gfx_PrintStringXY(buf, 4, y);
+            if (k == sel) {
+                gfx_SetTextFGColor(1);
+                gfx_SetTextBGColor(0);
+                gfx_SetTextTransparentColor(0);
+            }
+        }
+
+        /* detalhes do selecionado */
+        const Perfil *p = (ordem == 0) ? perfis_get(sel)
+                        : (ordem == 1) ? perfis_por_S(sel) : perfis_por_peso(sel);
+        DispVal dd = disp_len(p->d), dA = disp_area(p->A);
+        DispVal dIx = disp_m4(p->Ix), dIy = disp_m4(p->Iy), dZ = disp_m3(p->Z);
+        sprintf(buf, "d=%.1f %s  A=%.2f %s^2", dd.val, dd.unit, dA.val, dA.unit);
+        gfx_PrintStringXY(buf, 2, 142);
+        sprintf(buf, "Ix=%.1f %s^4  Iy=%.1f %s^4", dIx.val, dIx.unit, dIy.val, dIy.unit);
+        gfx_PrintStringXY(buf, 2, 154);
+        sprintf(buf, "Z=%.1f %s^3", dZ.val, dZ.unit);
+        gfx_PrintStringXY(buf, 2, 166);
+
+        gfx_PrintStringXY("UP/DOWN: lista  1: ordem  2: S minimo", 2, 196);
+        gfx_PrintStringXY("ENTER: usar como figura  CLEAR: voltar", 2, 208);
+
+        while (1) {
+            check_on_exit();
+            tela_scan();
+            if (pressed_once(kb_KeyUp))   { if (sel > 0) sel--; break; }
+            if (pressed_once(kb_KeyDown)) { if (sel < total - 1) sel++; break; }
+            if (pressed_once(kb_Key1))    { ordem = (ordem + 1) % 3; sel = topo = 0; break; }
+            if (pressed_once(kb_Key2)) {
+                char t[STRBUF];
+                snprintf(t, sizeof t, "S minimo [%s^3]:", unit_name);
+                real_t f = unit_factor;
+                real_t Smin = input_double(t) * f * f * f;
+                int k;
+                perfis_faixa_S(Smin, 1e9, &k);
+                ordem = 1;
+                sel = (k < total) ? k : total - 1;
+                topo = sel;
+                break;
+            }
+            if (pressed_once(kb_KeyEnter)) {
+                centroid_carregar_perfil(p);
+                wait_key_release();
+                return;
+            }
+            if (pressed_once(kb_KeyClear)) { wait_key_release(); return; }
+            entrada_dormir();
+        }
+    }
+}
+
+/* ======== Importar seção (bitmap PBM/PGM ou desenho DXF/SVG em AppVar) ======== */
+static void tela_importar(void) {
+    char nomes[9][9];
+    char buf[64];
+    int nb = bitmap_listar(nomes, 9);
+    int n = nb + desenho_listar(&nomes[nb], 9 - nb);   /* [0,nb) bitmaps, [nb,n) desenhos */
+
+    tela_limpar();
+    gfx_SetTextFGColor(1);
+    gfx_PrintStringXY("IMPORTAR SECAO (PBM/PGM, DXF/SVG)", 2, 2);
+    if (n == 0) {
+        gfx_PrintStringXY("Nenhuma AppVar com imagem ou desenho.", 2, 24);
+        gfx_PrintStringXY("Imagem: preto (ou escuro) = material.", 2, 36);
+        gfx_PrintStringXY("Desenho: maior laco = contorno,", 2, 48);
+        gfx_PrintStringXY("resto = furos (SVG: sentido oposto).", 2, 60);
+        gfx_PrintStringXY("ENTER/CLEAR: voltar", 2, 210);
+        while (1) {
+            check_on_exit();
+            tela_scan();
+            if (pressed_once(kb_KeyEnter) || pressed_once(kb_KeyClear)) break;
+            entrada_dormir();
+        }
+        wait_key_release();
+        return;
+    }
+    for (int i = 0; i < n; i++) {
+        snprintf(buf, sizeof buf, "%d) %.8s  (%s)", i + 1, nomes[i], (i < nb) ? "imagem" : "desenho");
+        gfx_PrintStringXY(buf, 2, 20 + 12*i);
+    }
+    gfx_PrintStringXY("1..9 escolhe, CLEAR volta", 2, 210);
+
+    int k = -1;
+    while (k < 0) {
+        check_on_exit();
+        tela_scan();
+        if (pressed_once(kb_KeyClear)) { wait_key_release(); return; }
+        if (pressed_once(kb_Key1)) k = 0;
+        else if (pressed_once(kb_Key2)) k = 1;
+        else if (pressed_once(kb_Key3)) k = 2;
+        else if (pressed_once(kb_Key4)) k = 3;
+        else if (pressed_once(kb_Key5)) k = 4;
+        else if (pressed_once(kb_Key6)) k = 5;
+        else if (pressed_once(kb_Key7)) k = 6;
+        else if (pressed_once(kb_Key8)) k = 7;
+        else if (pressed_once(kb_Key9)) k = 8;
+        if (k >= n) k = -1;
+        entrada_dormir();
+    }
+    wait_key_release();
+
+    bool imagem = (k < nb);
+    sprintf(buf, imagem ? "Lado do pixel (%s):" : "1 unidade do desenho (%s):", unit_name);
+    real_t tam = input_double(buf) * unit_factor;
+
+    SecMomentos m;
+    bool ok;
+    const char *falha, *dica = NULL;
+    tela_limpar();
+    gfx_PrintStringXY(imagem ? "Lendo imagem..." : "Lendo desenho...", 2, 2);
+    tela_mostrar();   /* aparece antes da leitura, que demora */
+    if (imagem) {
+        BitmapInfo bi;
+        ok = bitmap_importar(nomes[k], tam, &m, &bi);
+        snprintf(sec_imp_desc, sizeof sec_imp_desc, "%dx%d px, %ld px de material", bi.w, bi.h, bi.pixels);
+        falha = "Falha: formato, tamanho ou imagem vazia.";
+    } else {
+        DesenhoInfo di;
+        ok = desenho_importar(nomes[k], tam, &m, &di);
+        snprintf(sec_imp_desc, sizeof sec_imp_desc, "%s: %d lacos, %ld vertices", di.svg ? "SVG" : "DXF", di.lacos, di.vertices);
+        falha = "Falha: nenhum laco fechado com area.";
+        if (di.fora) {
+            falha = "Falha: furo fora do contorno externo.";
+            dica = "(solidos separados: um arquivo cada)";
+        }
+    }
+    if (!ok) {
+        tela_limpar();
+        gfx_PrintStringXY(falha, 2, 24);
+        if (dica) gfx_PrintStringXY(dica, 2, 36);
+        gfx_PrintStringXY("ENTER/CLEAR: voltar", 2, 210);
+        while (1) {
+            check_on_exit();
+            tela_scan();
+            if (pressed_once(kb_KeyEnter) || pressed_once(kb_KeyClear)) break;
+            entrada_dormir();
+        }
+        wait_key_release();
+        return;
+    }
+
+    memset(R, 0, sizeof(R));
+    N = 0;
+    sec_imp = m;
+    strcpy(sec_imp_nome, nomes[k]);
+    sec_importada = true;
+    figura_mudou();
+    tela_propriedades();
+}
+
 /* ======== MENU ======== */
 static void tela_menu(void) {
     for (;;) {
         check_on_exit();
-        kb_Scan();
+        tela_scan();
 
-        gfx_FillScreen(0);
+        tela_limpar();
         gfx_SetTextFGColor(1);
-        gfx_PrintStringXY("=== MENU FIGURA ===", 2, 2);
+        tela_texto("=== MENU FIGURA ===", 2, 2);
         char ubuf[32];
         snprintf(ubuf, sizeof ubuf, "Unidade: %s", unit_name);
         gfx_PrintStringXY(ubuf, 200, 2);
-        gfx_PrintStringXY("1) Centroide (passos)", 2, 18);
-        gfx_PrintStringXY("2) Inercia Ix (passos)", 2, 30);
-        gfx_PrintStringXY("3) Refazer figura", 2, 42);
-        gfx_PrintStringXY("4) Voltar menu principal", 2, 54);
-        gfx_PrintStringXY("5) Alterar unidade", 2, 66);
+        tela_texto("1) Centroide (passos)", 2, 18);
+        tela_texto("2) Inercia Ix (passos)", 2, 30);
+        tela_texto("3) Refazer figura", 2, 42);
+        tela_texto("4) Voltar menu principal", 2, 54);
+        tela_texto("5) Alterar unidade", 2, 66);
+        tela_texto("6) Propriedades (Iy, Ixy, S, r)", 2, 78);
+        tela_texto("7) Plastico (LNP, Z)", 2, 90);
+        tela_texto("8) Perfil do catalogo", 160, 90);
+        tela_texto("9) Importar secao", 160, 78);
 
         /* preview abaixo */
         desenhar_secao_preview();
@@ -838,13 +1309,18 @@ static void tela_menu(void) {
         /* espera tecla com borda */
         while (1) {
             check_on_exit();
-            kb_Scan();
-            if (pressed_once(kb_Key1)) { calc_centroid(1); break; }            /* centroide passos */
-            if (pressed_once(kb_Key2)) { calc_Ix(1); break; }                  /* Ix passos */
+            tela_scan();
+            /* seção importada não tem retângulos: passos viram o registro de propriedades */
+            if (pressed_once(kb_Key1)) { if (sec_importada) tela_propriedades(); else calc_centroid(1); break; }
+            if (pressed_once(kb_Key2)) { if (sec_importada) tela_propriedades(); else calc_Ix(1); break; }
             if (pressed_once(kb_Key3)) { tela_construir(); break; }
             if (pressed_once(kb_Key5)) { selecionar_unidade(); break; }
+            if (pressed_once(kb_Key6)) { tela_propriedades(); break; }
+            if (pressed_once(kb_Key7)) { tela_plastico(); break; }
+            if (pressed_once(kb_Key8)) { tela_catalogo(); break; }
+            if (pressed_once(kb_Key9)) { tela_importar(); break; }
             if (pressed_once(kb_Key4) || pressed_once(kb_KeyClear)) { wait_key_release(); return; }
-            delay(10);
+            entrada_dormir();
         }
     }
 }
@@ -852,7 +1328,7 @@ static void tela_menu(void) {
 /* ======== API pública ======== */
 void centroid_module(void) {
     /* Se não houver figura, chama o construir */
-    if (N == 0) {
+    if (N == 0 && !sec_importada) {
         tela_construir();
     }
     tela_menu();
@@ -0,0 +1,123 @@
+/*  src/cisalhamento.c
+    Módulo CISALHAMENTO (tau = V*Q/(I*b)) para MECSOL - TI-84 Plus CE
+    b(y) vem da varredura da união em y (uniao.c); Q(y) sai de somas de
+    prefixo de área e momento estático. Cada tau(y) é uma busca binária.
+
+    Autor: https://github.com/daniSoares08
+*/
+
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+
+#include "secao.h"
+
+#define MAX_FAIXAS (2*UNIAO_MAX_RECT)
+
+static Faixa fx[MAX_FAIXAS];            /* faixas em y, m0 = b             */
+static real_t PA[MAX_FAIXAS + 1];       /* área abaixo de fx[k].a          */
+static real_t PQ[MAX_FAIXAS + 1];       /* Int y dA abaixo de fx[k].a      */
+static int nfx = 0;
+static real_t ybar = 0.0, Ix = 0.0;
+static unsigned rev_ok = 0;
+static bool ok = false;
+
+static bool preparar(void) {
+    unsigned rev = centroid_get_revisao();
+    if (ok && rev == rev_ok) return nfx > 0 && Ix > 0.0;
+
+    int n = 0;
+    const Rect *r = centroid_get_rects(&n);
+    const SecProps *p = centroid_get_props();
+    nfx = uniao_faixas(r, n, 1, fx, MAX_FAIXAS);
+
+    PA[0] = PQ[0] = 0.0;
+    for (int k = 0; k < nfx; k++) {
+        real_t A = fx[k].m0 * (fx[k].b - fx[k].a);
+        PA[k+1] = PA[k] + A;
+        PQ[k+1] = PQ[k] + A * 0.5 * (fx[k].a + fx[k].b);
+    }
+    ybar = p ? p->ybar : 0.0;
+    Ix   = p ? p->Ix   : 0.0;
+    rev_ok = rev;
+    ok = true;
+    return nfx > 0 && Ix > 0.0;
+}
+
+/* última faixa com início <= y (ou -1 abaixo da seção) */
+static int faixa_em(real_t y) {
+    int lo = 0, hi = nfx - 1, k = -1;
+    while (lo <= hi) {
+        int m = (lo + hi) / 2;
+        if (fx[m].a <= y) { k = m; lo = m + 1; } else hi = m - 1;
+    }
+    return k;
+}
+
+/* Q(y) da parte abaixo de y em torno do eixo neutro (= Q da parte de cima)
+   dentro da faixa k (fx[k].a <= y <= fx[k].b) */
+static real_t Q_na_faixa(int k, real_t y) {
+    real_t dA = fx[k].m0 * (y - fx[k].a);
+    real_t Ab = PA[k] + dA;
+    real_t Qb = PQ[k] + dA * 0.5 * (fx[k].a + y);
+    return ybar * Ab - Qb;
+}
+
+/* Q(y) [m^3] e b(y) [m]; b=0 fora da seção ou num vão entre partes */
+real_t cisalhamento_Q(real_t y, real_t *pb) {
+    if (pb) *pb = 0.0;
+    if (!preparar()) return 0.0;
+    int k = faixa_em(y);
+    if (k < 0) return 0.0;
+    if (y > fx[k].b) {
+        /* acima da faixa k: vão ou acima do topo, Q fica no valor da borda */
+        return Q_na_faixa(k, fx[k].b);
+    }
+    if (pb) *pb = fx[k].m0;
+    return Q_na_faixa(k, y);
+}
+
+/* tau(y) = V*Q/(Ix*b) [N/m^2]; O(log n) */
+real_t cisalhamento_tau(real_t V, real_t y) {
+    real_t b;
+    real_t Q = cisalhamento_Q(y, &b);
+    if (b <= 0.0 || Ix <= 0.0) return 0.0;
+    return V * Q / (Ix * b);
+}
+
+/* Máximo exato de Q/b: em cada faixa Q é uma parábola com pico em y_bar,
+   então basta olhar as bordas e y_bar quando ele cai dentro da faixa. */
+real_t cisalhamento_tau_max(real_t V, real_t *py) {
+    real_t best = 0.0, ybest = ybar;
+    if (!preparar()) {
+        if (py) *py = 0.0;
+        return 0.0;
+    }
+    for (int k = 0; k < nfx; k++) {
+        real_t b = fx[k].m0;
+        if (b <= 0.0) continue;
+        real_t cand[3] = { fx[k].a, fx[k].b, ybar };
+        int nc = (ybar > fx[k].a && ybar < fx[k].b) ? 3 : 2;
+        for (int c = 0; c < nc; c++) {
+            real_t q = fabs(Q_na_faixa(k, cand[c]) / b);
+            if (q > best) { best = q; ybest = cand[c]; }
+        }
+    }
+    if (py) *py = ybest;
+    return fabs(V) * best / Ix;
+}
+
+/* perfil denso: ys[] crescente -> tau[]; anda nas faixas junto com y, O(n + faixas) */
+void cisalhamento_perfil(real_t V, const real_t *ys, real_t *tau, int n) {
+    if (!preparar()) {
+        for (int i = 0; i < n; i++) tau[i] = 0.0;
+        return;
+    }
+    int k = 0;
+    for (int i = 0; i < n; i++) {
+        real_t y = ys[i];
+        while (k < nfx && fx[k].b < y) k++;
+        if (k >= nfx || y < fx[k].a || fx[k].m0 <= 0.0) { tau[i] = 0.0; continue; }
+        tau[i] = V * Q_na_faixa(k, y) / (Ix * fx[k].m0);
+    }
+}
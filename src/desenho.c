@@ -0,0 +1,494 @@
+/*  src/desenho.c
+    Importa SECAO de desenho DXF (LWPOLYLINE) ou SVG (path / polygon) para
+    MECSOL - TI-84 Plus CE
+    Leitura em fluxo, um caractere por vez: cada vértice que chega soma a
+    aresta anterior nos momentos do laço (teorema de Green), então nenhum
+    polígono fica guardado na memória. Ao fechar um laço os momentos são
+    orientados (área > 0) e comparados com o maior até agora: o maior laço
+    é o contorno externo. Os demais vão para uma soma por sentido de giro
+    (antes de orientar), com a caixa envolvente de cada soma; a memória fica
+    constante, seja qual for o tamanho do arquivo.
+      - DXF: pares (código, valor); 10/20 = vértice, 42 = bulge (arco,
+        quebrado em N_ARCO segmentos). Toda polilinha é tratada como fechada
+        e todo laço que não é o maior é furo.
+      - SVG: atributos d="..." (M L H V Z C S Q T A, absolutos e relativos;
+        curvas de Bézier em N_CURVA segmentos, arco elíptico convertido de
+        extremos para centro e quebrado em N_ARCO segmentos) e points="..."
+        (polygon/polyline). y do SVG aponta para baixo: é invertido. Laço no
+        sentido oposto ao do contorno é furo; no mesmo sentido é outro sólido.
+    Furo cuja caixa sai da caixa do contorno externo não é furo dele (são
+    sólidos separados ou sentido trocado): a importação é recusada.
+    Coordenadas relativas ao primeiro vértice do arquivo (menos cancelamento
+    em float) e, no fim, transladadas para o canto inferior esquerdo.
+
+    Autor: https://github.com/daniSoares08
+*/
+
+#include <fileioc.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "secao.h"
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+#define N_ARCO  8
+#define N_CURVA 8
+#define MAX_TXT 40
+
+/* ======== laço atual e acumuladores ======== */
+static SecMomentos laco, maior;
+static SecMomentos resto[2];                /* demais laços: [0] anti-horário, [1] horário (antes de orientar) */
+static bool tem_maior, maior_hor;
+static real_t ref_x, ref_y;
+static bool tem_ref;
+static real_t x_ini, y_ini, x_ant, y_ant;   /* relativos a ref */
+static long nv_laco;
+static real_t bulge;                        /* DXF: arco da aresta que sai do último vértice */
+static DesenhoInfo *inf;
+
+static void zerar(SecMomentos *m) {
+    memset(m, 0, sizeof *m);
+    m->xmin = m->ymin = 1e30;
+    m->xmax = m->ymax = -1e30;
+}
+
+/* aresta (x0,y0) -> (x1,y1) nos momentos do laço */
+static void aresta(real_t x0, real_t y0, real_t x1, real_t y1) {
+    real_t c = x0*y1 - x1*y0;
+    laco.A   += c / 2.0;
+    laco.Sx  += (x0 + x1) * c / 6.0;
+    laco.Sy  += (y0 + y1) * c / 6.0;
+    laco.Iyy += (x0*x0 + x0*x1 + x1*x1) * c / 12.0;
+    laco.Ixx += (y0*y0 + y0*y1 + y1*y1) * c / 12.0;
+    laco.Ixy += (x0*y1 + 2.0*x0*y0 + 2.0*x1*y1 + x1*y0) * c / 24.0;
+}
+
+static void vertice(real_t x, real_t y) {
+    if (!tem_ref) {
+        ref_x = x; ref_y = y;
+        tem_ref = true;
+    }
+    x -= ref_x; y -= ref_y;
+    if (nv_laco == 0) {
+        x_ini = x; y_ini = y;
+    } else {
+        aresta(x_ant, y_ant, x, y);
+    }
+    if (x < laco.xmin) laco.xmin = x;
+    if (x > laco.xmax) laco.xmax = x;
+    if (y < laco.ymin) laco.ymin = y;
+    if (y > laco.ymax) laco.ymax = y;
+    x_ant = x; y_ant = y;
+    nv_laco++;
+    inf->vertices++;
+}
+
+/* arco de bulge b (= tan(theta/4)) do último vértice até (x1,y1), absolutos */
+static void arco_bulge(real_t x1, real_t y1, real_t b) {
+    real_t x0 = x_ant + ref_x, y0 = y_ant + ref_y;
+    real_t cx = x1 - x0, cy = y1 - y0;
+    real_t k = (1.0 - b*b) / (4.0 * b);
+    real_t xc = 0.5*(x0 + x1) - cy*k, yc = 0.5*(y0 + y1) + cx*k;
+    real_t r = sqrt((x0 - xc)*(x0 - xc) + (y0 - yc)*(y0 - yc));
+    real_t a0 = atan2(y0 - yc, x0 - xc), th = 4.0 * atan(b);
+    for (int i = 1; i < N_ARCO; i++) {
+        real_t a = a0 + th * i / N_ARCO;
+        vertice(xc + r*cos(a), yc + r*sin(a));
+    }
+}
+
+static void somar(SecMomentos *d, const SecMomentos *s, real_t f) {
+    d->A += f*s->A;     d->Sx += f*s->Sx;   d->Sy += f*s->Sy;
+    d->Ixx += f*s->Ixx; d->Iyy += f*s->Iyy; d->Ixy += f*s->Ixy;
+}
+
+/* soma s em d junto com a caixa envolvente */
+static void juntar(SecMomentos *d, const SecMomentos *s) {
+    somar(d, s, 1.0);
+    if (s->xmin < d->xmin) d->xmin = s->xmin;
+    if (s->xmax > d->xmax) d->xmax = s->xmax;
+    if (s->ymin < d->ymin) d->ymin = s->ymin;
+    if (s->ymax > d->ymax) d->ymax = s->ymax;
+}
+
+/* caixa de s dentro da caixa de c (vazia conta como dentro) */
+static bool caixa_dentro(const SecMomentos *s, const SecMomentos *c) {
+    if (s->xmin > s->xmax) return true;
+    real_t tol = 1e-6 * ((c->xmax - c->xmin) + (c->ymax - c->ymin));
+    return s->xmin >= c->xmin - tol && s->xmax <= c->xmax + tol &&
+           s->ymin >= c->ymin - tol && s->ymax <= c->ymax + tol;
+}
+
+static void fechar_laco(void) {
+    if (nv_laco > 0 && bulge != 0.0) arco_bulge(x_ini + ref_x, y_ini + ref_y, bulge);
+    if (nv_laco >= 3) {
+        aresta(x_ant, y_ant, x_ini, y_ini);
+        bool hor = (laco.A < 0.0);
+        if (hor) {                                /* sentido horário: inverte */
+            SecMomentos t = laco;
+            zerar(&laco);
+            somar(&laco, &t, -1.0);
+            laco.xmin = t.xmin; laco.xmax = t.xmax;
+            laco.ymin = t.ymin; laco.ymax = t.ymax;
+        }
+        if (laco.A > 0.0) {
+            inf->lacos++;
+            if (!tem_maior || laco.A > maior.A) {
+                if (tem_maior) juntar(&resto[maior_hor], &maior);
+                maior = laco;
+                maior_hor = hor;
+                tem_maior = true;
+            } else {
+                juntar(&resto[hor], &laco);
+            }
+        }
+    }
+    zerar(&laco);
+    nv_laco = 0;
+    bulge = 0.0;
+}
+
+/* ======== leitura caractere a caractere ======== */
+static uint8_t arq;
+static int devolvido = -1;
+
+static int ler(void) {
+    int c = devolvido;
+    if (c >= 0) {
+        devolvido = -1;
+        return c;
+    }
+    return ti_GetC(arq);
+}
+
+static void devolver(int c) {
+    if (c != EOF) devolvido = c;
+}
+
+/* ======== DXF ======== */
+
+/* uma linha sem espaços nas pontas; false no fim do arquivo */
+static bool ler_linha(char *s) {
+    int c, n = 0;
+    while ((c = ler()) != EOF && c != '\n') {
+        if (c == '\r') continue;
+        if (n == 0 && (c == ' ' || c == '\t')) continue;
+        if (n < MAX_TXT - 1) s[n++] = (char)c;
+    }
+    while (n > 0 && (s[n-1] == ' ' || s[n-1] == '\t')) n--;
+    s[n] = '\0';
+    return !(c == EOF && n == 0);
+}
+
+static void ler_dxf(void) {
+    char cod[MAX_TXT], val[MAX_TXT];
+    bool em_poly = false, tem_x = false;
+    real_t x = 0.0, b_vert = 0.0;
+
+    while (ler_linha(cod) && ler_linha(val)) {
+        int g = atoi(cod);
+        if (g == 0) {
+            if (em_poly) {
+                bulge = b_vert;
+                fechar_laco();
+            }
+            em_poly = (strcmp(val, "LWPOLYLINE") == 0);
+            tem_x = false;
+            b_vert = 0.0;
+        } else if (!em_poly) {
+            continue;
+        } else if (g == 10) {
+            x = strtod(val, NULL);
+            tem_x = true;
+        } else if (g == 20 && tem_x) {
+            real_t y = strtod(val, NULL);
+            if (nv_laco > 0 && b_vert != 0.0) arco_bulge(x, y, b_vert);
+            vertice(x, y);
+            b_vert = 0.0;
+            tem_x = false;
+        } else if (g == 42) {
+            b_vert = strtod(val, NULL);          /* vale para a aresta que sai deste vértice */
+        }
+    }
+    if (em_poly) {
+        bulge = b_vert;
+        fechar_laco();
+    }
+}
+
+/* ======== SVG ======== */
+
+static bool eh_sep(int c) {
+    return c == ' ' || c == ',' || c == '\t' || c == '\r' || c == '\n';
+}
+
+/* próximo número do atributo; false (sem consumir) se vier letra/aspas */
+static bool ler_num(real_t *v) {
+    char s[MAX_TXT];
+    int c, n = 0;
+    bool ponto = false, expo = false;
+    do c = ler(); while (eh_sep(c));
+    if (!(c == '-' || c == '+' || c == '.' || (c >= '0' && c <= '9'))) {
+        devolver(c);
+        return false;
+    }
+    for (;;) {
+        if (n < MAX_TXT - 1) s[n++] = (char)c;
+        int p = c;
+        c = ler();
+        if (c >= '0' && c <= '9') continue;
+        if (c == '.' && !ponto && !expo) { ponto = true; continue; }
+        if ((c == 'e' || c == 'E') && !expo) { expo = true; continue; }
+        if ((c == '-' || c == '+') && (p == 'e' || p == 'E')) continue;
+        break;
+    }
+    devolver(c);
+    s[n] = '\0';
+    *v = strtod(s, NULL);
+    return true;
+}
+
+static void ponto_svg(real_t x, real_t y) {
+    vertice(x, -y);
+}
+
+/* Bézier cúbica de (x0,y0) com controles 1, 2 e fim 3 (coordenadas SVG) */
+static void bezier3(real_t x0, real_t y0, real_t x1, real_t y1,
+                    real_t x2, real_t y2, real_t x3, real_t y3) {
+    for (int i = 1; i <= N_CURVA; i++) {
+        real_t t = (real_t)i / N_CURVA, u = 1.0 - t;
+        real_t a = u*u*u, b = 3.0*u*u*t, c = 3.0*u*t*t, d = t*t*t;
+        ponto_svg(a*x0 + b*x1 + c*x2 + d*x3, a*y0 + b*y1 + c*y2 + d*y3);
+    }
+}
+
+/* arco elíptico SVG de (x0,y0) até (x1,y1): extremos -> centro (SVG 1.1,
+   F.6.5, raios aumentados como em F.6.6.2) e N_ARCO segmentos; o último
+   vértice (o próprio extremo) fica com quem chama */
+static void arco_svg(real_t x0, real_t y0, real_t rx, real_t ry, real_t fi_graus,
+                     bool grande, bool positivo, real_t x1, real_t y1) {
+    rx = fabs(rx); ry = fabs(ry);
+    if (rx == 0.0 || ry == 0.0 || (x0 == x1 && y0 == y1)) return;   /* vira reta */
+    real_t fi = fi_graus * (M_PI / 180.0), cf = cos(fi), sf = sin(fi);
+    real_t dx = 0.5*(x0 - x1), dy = 0.5*(y0 - y1);
+    real_t xl =  cf*dx + sf*dy, yl = -sf*dx + cf*dy;
+    real_t lam = xl*xl/(rx*rx) + yl*yl/(ry*ry);
+    if (lam > 1.0) {                              /* raios pequenos demais */
+        real_t k = sqrt(lam);
+        rx *= k; ry *= k;
+    }
+    real_t rx2 = rx*rx, ry2 = ry*ry;
+    real_t den = rx2*yl*yl + ry2*xl*xl;
+    real_t q = (rx2*ry2 - den) / den;
+    real_t co = (q > 0.0) ? sqrt(q) : 0.0;
+    if (grande == positivo) co = -co;
+    real_t cxl = co * rx*yl/ry, cyl = -co * ry*xl/rx;
+    real_t xc = cf*cxl - sf*cyl + 0.5*(x0 + x1);
+    real_t yc = sf*cxl + cf*cyl + 0.5*(y0 + y1);
+    real_t t0 = atan2((yl - cyl)/ry, (xl - cxl)/rx);
+    real_t dt = atan2((-yl - cyl)/ry, (-xl - cxl)/rx) - t0;
+    if (!positivo && dt > 0.0) dt -= 2.0*M_PI;          /* sweep-flag: sentido do ângulo */
+    else if (positivo && dt < 0.0) dt += 2.0*M_PI;
+    for (int i = 1; i < N_ARCO; i++) {
+        real_t t = t0 + dt * i / N_ARCO, ct = cos(t), st = sin(t);
+        ponto_svg(xc + rx*cf*ct - ry*sf*st, yc + rx*sf*ct + ry*cf*st);
+    }
+}
+
+/* d="...": cada subcaminho (M ... Z / próximo M) é um laço */
+static void ler_path(int aspas) {
+    real_t cx = 0.0, cy = 0.0, sx = 0.0, sy = 0.0;
+    real_t qx = 0.0, qy = 0.0;                   /* último controle (S/T) */
+    int cmd = 0, ant = 0;
+
+    for (;;) {
+        int c;
+        do c = ler(); while (eh_sep(c));
+        if (c == aspas || c == EOF) break;
+        if ((c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z')) {
+            cmd = c;
+            if (cmd == 'Z' || cmd == 'z') {
+                fechar_laco();
+                cx = sx; cy = sy;
+                ant = cmd;
+                continue;
+            }
+        } else {
+            devolver(c);
+            if (!cmd || cmd == 'Z' || cmd == 'z') break;   /* número sem comando */
+        }
+
+        bool rel = (cmd >= 'a');
+        real_t bx = rel ? cx : 0.0, by = rel ? cy : 0.0;
+        real_t v[7];
+        int na;
+        switch (cmd | 0x20) {
+            case 'm': case 'l': case 't': na = 2; break;
+            case 'h': case 'v': na = 1; break;
+            case 'c': na = 6; break;
+            case 's': case 'q': na = 4; break;
+            case 'a': na = 7; break;
+            default: return;
+        }
+        for (int i = 0; i < na; i++)
+            if (!ler_num(&v[i])) return;
+
+        switch (cmd | 0x20) {
+            case 'm':
+                fechar_laco();
+                cx = sx = bx + v[0]; cy = sy = by + v[1];
+                ponto_svg(cx, cy);
+                cmd = rel ? 'l' : 'L';               /* pares seguintes são L */
+                break;
+            case 'l':
+                cx = bx + v[0]; cy = by + v[1];
+                ponto_svg(cx, cy);
+                break;
+            case 'h':
+                cx = bx + v[0];
+                ponto_svg(cx, cy);
+                break;
+            case 'v':
+                cy = (rel ? cy : 0.0) + v[0];
+                ponto_svg(cx, cy);
+                break;
+            case 'c':
+                bezier3(cx, cy, bx + v[0], by + v[1], bx + v[2], by + v[3], bx + v[4], by + v[5]);
+                qx = bx + v[2]; qy = by + v[3];
+                cx = bx + v[4]; cy = by + v[5];
+                break;
+            case 's': {
+                bool r = ((ant | 0x20) == 'c' || (ant | 0x20) == 's');
+                real_t x1 = r ? 2.0*cx - qx : cx, y1 = r ? 2.0*cy - qy : cy;
+                bezier3(cx, cy, x1, y1, bx + v[0], by + v[1], bx + v[2], by + v[3]);
+                qx = bx + v[0]; qy = by + v[1];
+                cx = bx + v[2]; cy = by + v[3];
+                break;
+            }
+            case 'q':
+            case 't': {
+                real_t x1, y1, x2, y2;
+                if ((cmd | 0x20) == 'q') {
+                    x1 = bx + v[0]; y1 = by + v[1];
+                    x2 = bx + v[2]; y2 = by + v[3];
+                } else {
+                    bool r = ((ant | 0x20) == 'q' || (ant | 0x20) == 't');
+                    x1 = r ? 2.0*cx - qx : cx; y1 = r ? 2.0*cy - qy : cy;
+                    x2 = bx + v[0]; y2 = by + v[1];
+                }
+                /* quadrática como cúbica: controles a 2/3 */
+                bezier3(cx, cy, cx + 2.0/3.0*(x1 - cx), cy + 2.0/3.0*(y1 - cy),
+                        x2 + 2.0/3.0*(x1 - x2), y2 + 2.0/3.0*(y1 - y2), x2, y2);
+                qx = x1; qy = y1;
+                cx = x2; cy = y2;
+                break;
+            }
+            case 'a':
+                arco_svg(cx, cy, v[0], v[1], v[2], v[3] != 0.0, v[4] != 0.0, bx + v[5], by + v[6]);
+                cx = bx + v[5]; cy = by + v[6];
+                ponto_svg(cx, cy);
+                break;
+        }
+        ant = cmd;
+    }
+    fechar_laco();
+}
+
+/* points="x,y x,y ...": um laço */
+static void ler_points(int aspas) {
+    real_t x, y;
+    while (ler_num(&x) && ler_num(&y)) ponto_svg(x, y);
+    int c;
+    do c = ler(); while (c != aspas && c != EOF);
+    fechar_laco();
+}
+
+/* procura ' d="' e ' points="' no fluxo */
+static void ler_svg(void) {
+    char ult[8] = { 0 };
+    int c;
+    while ((c = ler()) != EOF) {
+        if ((c == '"' || c == '\'') && ult[7] == '=') {
+            if (ult[6] == 'd' && eh_sep(ult[5])) ler_path(c);
+            else if (memcmp(&ult[1], "points", 6) == 0 && eh_sep(ult[0])) ler_points(c);
+        }
+        memmove(ult, ult + 1, 7);
+        ult[7] = (char)c;
+    }
+}
+
+/* ======== API ======== */
+
+/* AppVars que começam como DXF ("0" na primeira linha) ou SVG ("<?xml", "<svg") */
+int desenho_listar(char nomes[][9], int max) {
+    static const char *const magicos[5] = { "  0", "0\r", "0\n", "<?xml", "<svg" };
+    int n = 0;
+    for (int t = 0; t < 5; t++) {
+        void *pos = NULL;
+        char *nome;
+        while (n < max && (nome = ti_Detect(&pos, magicos[t])) != NULL) {
+            strncpy(nomes[n], nome, 8);
+            nomes[n][8] = '\0';
+            n++;
+        }
+    }
+    return n;
+}
+
+/* uma passada pelo arquivo; momentos em metros (escala = m por unidade do desenho) */
+bool desenho_importar(const char *nome, real_t escala, SecMomentos *m, DesenhoInfo *info) {
+    memset(m, 0, sizeof *m);
+    memset(info, 0, sizeof *info);
+    if (escala <= 0.0) return false;
+
+    arq = ti_Open(nome, "r");
+    if (!arq) return false;
+    devolvido = -1;
+    inf = info;
+    tem_ref = tem_maior = false;
+    zerar(&laco);
+    zerar(&resto[0]);
+    zerar(&resto[1]);
+    nv_laco = 0;
+    bulge = 0.0;
+
+    int c;
+    do c = ler(); while (c == ' ' || c == '\t' || c == '\r' || c == '\n');
+    devolver(c);
+    info->svg = (c == '<');
+    if (info->svg) ler_svg();
+    else           ler_dxf();
+    ti_Close(arq);
+
+    if (!tem_maior) return false;
+    /* SVG: mesmo sentido do contorno = sólido; DXF: tudo que sobra é furo */
+    const SecMomentos *furos = &resto[!maior_hor], *mesmo = &resto[maior_hor];
+    SecMomentos r = maior;
+    somar(&r, furos, -1.0);
+    if (info->svg) {
+        juntar(&r, mesmo);
+    } else {
+        somar(&r, mesmo, -1.0);
+        if (!caixa_dentro(mesmo, &maior)) info->fora = true;
+    }
+    if (!caixa_dentro(furos, &maior)) info->fora = true;
+    if (info->fora || r.A <= 0.0) return false;
+
+    /* origem no canto inferior esquerdo da figura toda, depois escala */
+    real_t dx = -r.xmin, dy = -r.ymin;
+    real_t s = escala, s2 = s*s, s3 = s2*s, s4 = s3*s;
+    m->A   = r.A * s2;
+    m->Sx  = (r.Sx + dx*r.A) * s3;
+    m->Sy  = (r.Sy + dy*r.A) * s3;
+    m->Iyy = (r.Iyy + 2.0*dx*r.Sx + dx*dx*r.A) * s4;
+    m->Ixx = (r.Ixx + 2.0*dy*r.Sy + dy*dy*r.A) * s4;
+    m->Ixy = (r.Ixy + dx*r.Sy + dy*r.Sx + dx*dy*r.A) * s4;
+    m->xmin = 0.0; m->xmax = (r.xmax - r.xmin) * s;
+    m->ymin = 0.0; m->ymax = (r.ymax - r.ymin) * s;
+    return true;
+}
@@ -0,0 +1,68 @@
+/*  src/dimensionar.c
+    Módulo DIMENSIONAR (perfil mais leve do catálogo) para MECSOL - TI-84 Plus CE
+    Percorre o catálogo em ordem crescente de massa (índice gerado em
+    perfis_tab.h) e descarta com limites baratos antes da verificação:
+      - material diferente do pedido;
+      - S < S_req = M/sig_adm (uma comparação, sem tocar no resto).
+    Quem passa verifica cisalhamento (tau_max = V*k_tau) e flecha
+    (|y| = C/(E*Ix)). Como a ordem é por massa, os N primeiros aprovados
+    já são os N mais leves e a busca para ali.
+
+    Autor: https://github.com/daniSoares08
+*/
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <math.h>
+
+#include "secao.h"
+
+/* maior razão demanda/capacidade; > 1 reprova. Sem S_req (já podado). */
+static real_t verificar(const Demanda *d, const Perfil *p) {
+    real_t u = 0.0;
+    if (d->sig_adm > 0.0 && p->S > 0.0f) {
+        real_t r = fabs(d->M) / (d->sig_adm * p->S);
+        if (r > u) u = r;
+    }
+    if (d->tau_adm > 0.0) {
+        real_t r = fabs(d->V) * p->k_tau / d->tau_adm;
+        if (r > u) u = r;
+    }
+    if (d->flecha_adm > 0.0 && d->E > 0.0 && p->Ix > 0.0f) {
+        real_t r = fabs(d->C_flecha) / (d->E * p->Ix) / d->flecha_adm;
+        if (r > u) u = r;
+    }
+    return u;
+}
+
+/* até max_n projetos aprovados, do mais leve ao mais pesado; devolve quantos */
+int dimensionar(const Demanda *d, Projeto *out, int max_n) {
+    int n = 0, total = perfis_total();
+    real_t S_req = (d->sig_adm > 0.0) ? fabs(d->M) / d->sig_adm : 0.0;
+
+    for (int k = 0; k < total && n < max_n; k++) {
+        const Perfil *p = perfis_por_peso(k);
+        if (d->mat >= 0 && p->mat != (unsigned char)d->mat) continue;
+        if (p->S < S_req) continue;            /* poda: flexão já reprova */
+
+        real_t u = verificar(d, p);
+        if (u > 1.0) continue;
+        out[n].p = p;
+        out[n].util = u;
+        n++;
+    }
+    return n;
+}
+
+/* vários membros de uma vez: só o mais leve de cada (NULL se nenhum passa).
+   Sem paralelismo no eZ80 (um núcleo); o custo é a poda por S_req, que
+   deixa a verificação completa para poucos perfis por membro. */
+int dimensionar_lote(const Demanda *d, int n, const Perfil **res) {
+    int ok = 0;
+    for (int i = 0; i < n; i++) {
+        Projeto pr;
+        res[i] = (dimensionar(&d[i], &pr, 1) == 1) ? pr.p : NULL;
+        if (res[i]) ok++;
+    }
+    return ok;
+}
@@ -0,0 +1,82 @@
+/*  src/dual.h
+    Números duais (derivada automática, modo direto) para MECSOL - TI-84 Plus CE
+    Cada Dual leva o valor e DUAL_N derivadas parciais; semeando um parâmetro
+    por posição, uma única passada devolve todas as derivadas juntas.
+    Só as operações usadas em centroid.c / viga.c / tensoes.c.
+
+    Autor: https://github.com/daniSoares08
+*/
+
+#ifndef DUAL_H
+#define DUAL_H
+
+#include <stdbool.h>
+
+#include "real.h"
+
+/* posições: b_i, h_i do retângulo, P_j, a_j da carga pontual */
+#define DUAL_N 4
+enum { DS_B, DS_H, DS_P, DS_A };
+
+typedef struct { real_t v; real_t d[DUAL_N]; } Dual;
+
+static inline Dual dual_c(real_t v) {
+    Dual r = { v, {0} };
+    return r;
+}
+
+/* variável independente na posição k (k < 0 -> constante) */
+static inline Dual dual_var(real_t v, int k) {
+    Dual r = dual_c(v);
+    if (k >= 0 && k < DUAL_N) r.d[k] = 1.0;
+    return r;
+}
+
+static inline Dual dual_add(Dual a, Dual b) {
+    for (int k = 0; k < DUAL_N; k++) a.d[k] += b.d[k];
+    a.v += b.v;
+    return a;
+}
+
+static inline Dual dual_sub(Dual a, Dual b) {
+    for (int k = 0; k < DUAL_N; k++) a.d[k] -= b.d[k];
+    a.v -= b.v;
+    return a;
+}
+
+static inline Dual dual_esc(Dual a, real_t s) {
+    for (int k = 0; k < DUAL_N; k++) a.d[k] *= s;
+    a.v *= s;
+    return a;
+}
+
+static inline Dual dual_mul(Dual a, Dual b) {
+    Dual r;
+    r.v = a.v * b.v;
+    for (int k = 0; k < DUAL_N; k++) r.d[k] = a.d[k] * b.v + a.v * b.d[k];
+    return r;
+}
+
+/* b.v != 0 fica por conta de quem chama */
+static inline Dual dual_div(Dual a, Dual b) {
+    Dual r;
+    r.v = a.v / b.v;
+    for (int k = 0; k < DUAL_N; k++) r.d[k] = (a.d[k] - r.v * b.d[k]) / b.v;
+    return r;
+}
+
+/* ======== seção (centroid.c) ======== */
+typedef struct { Dual A, ybar, Ix, c_sup, c_inf; } SecDual;
+
+/* propriedades com b_i/h_i do retângulo i semeados em slot_b/slot_h
+   (-1 = não semear). false sem figura ou com sobreposição. */
+bool centroid_props_dual(int i, int slot_b, int slot_h, SecDual *s);
+
+/* ======== viga (viga.c) ======== */
+int  viga_n_cargas_p(void);
+
+/* M(x) com P_j/a_j da carga pontual j semeados em slot_P/slot_a;
+   lado = -1/+1: limite à esquerda/direita de x (x num evento) */
+bool viga_momento_dual(real_t x, int lado, int j, int slot_P, int slot_a, Dual *M);
+
+#endif
@@ -0,0 +1,120 @@
+/*  src/entrada.c
+    Camada de teclado para MECSOL - TI-84 Plus CE (ver entrada.h)
+
+    Autor: https://github.com/daniSoares08
+*/
+
+#include <graphx.h>
+#include <keypadc.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <tice.h>
+
+#include "entrada.h"
+#include "tela.h"
+
+/* espera entre duas comparações do teclado. Um HALT só acorda com
+   interrupção, e não foi medido (CEmu) se o SO mantém uma periódica ligada
+   durante o programa: sem ela, só ON acordaria. Então a espera tem prazo
+   fixo pelo timer (delay) e a latência de uma tecla fica <= ESPERA_MS. */
+#define ESPERA_MS 10
+
+#ifdef MECSOL_HOST
+#include "host.h"
+#define ESPERAR() host_dormir(ESPERA_MS)
+#else
+#define ESPERAR() delay(ESPERA_MS)
+#endif
+
+static uint8_t agora[8], antes[8];
+
+typedef struct { kb_lkey_t tecla; char c; } TeclaChar;
+
+static const TeclaChar DIGITOS[] = {
+    { kb_Key0, '0' }, { kb_Key1, '1' }, { kb_Key2, '2' }, { kb_Key3, '3' },
+    { kb_Key4, '4' }, { kb_Key5, '5' }, { kb_Key6, '6' }, { kb_Key7, '7' },
+    { kb_Key8, '8' }, { kb_Key9, '9' }, { kb_KeyDecPnt, '.' },
+    { kb_KeyChs, '-' }, { kb_KeySub, '-' },
+};
+
+void entrada_scan(void) {
+    memcpy(antes, agora, sizeof agora);
+    tela_scan();
+    if (kb_On) {
+        gfx_End();
+        exit(0);
+    }
+    for (uint8_t g = 1; g < 8; g++) agora[g] = kb_Data[g];
+}
+
+bool entrada_apertou(kb_lkey_t k) {
+    uint8_t g = (uint8_t)(k >> 8), b = (uint8_t)(k & 0xFF);
+    return (agora[g] & b) && !(antes[g] & b);
+}
+
+bool entrada_alguma(void) {
+    return (agora[1] | agora[2] | agora[3] | agora[4] | agora[5] | agora[6] | agora[7]) != 0;
+}
+
+void entrada_soltar(void) {
+    for (;;) {
+        entrada_scan();
+        if (!entrada_alguma()) break;
+        entrada_dormir();
+    }
+    delay(15);
+}
+
+/* o teclado ainda está como no último kb_Scan? (ON conta como mudança) */
+static bool igual(const uint8_t *visto) {
+    if (kb_On) return false;
+    for (uint8_t g = 1; g < 8; g++)
+        if (kb_Data[g] != visto[g]) return false;
+    return true;
+}
+
+void entrada_dormir(void) {
+    uint8_t visto[8];
+    for (uint8_t g = 1; g < 8; g++) visto[g] = kb_Data[g];
+
+    tela_mostrar();                 /* o que mudou vai ao LCD antes de parar */
+    kb_SetMode(MODE_3_CONTINUOUS);
+    while (igual(visto)) ESPERAR();
+    kb_SetMode(MODE_0_IDLE);        /* o próximo kb_Scan lê o estado novo */
+}
+
+void entrada_linha(char *buf, int maxlen, int x, int y, int w) {
+    int idx = 0;
+    bool dirty = true;   /* só redesenha quando muda */
+    buf[0] = '\0';
+
+    entrada_scan();      /* tecla que já vinha segurada não digita */
+    memcpy(antes, agora, sizeof agora);
+
+    for (;;) {
+        if (dirty) {
+            gfx_SetColor(0);
+            gfx_FillRectangle(x, y, w, 12);
+            gfx_SetTextFGColor(1);
+            gfx_PrintStringXY(buf, x, y);
+            tela_sujar(x, y, w, 12);
+            dirty = false;
+        }
+
+        entrada_scan();
+        if (entrada_apertou(kb_KeyEnter)) { entrada_soltar(); return; }
+        if (entrada_apertou(kb_KeyClear) || entrada_apertou(kb_KeyDel)) {
+            if (idx > 0) { buf[--idx] = '\0'; dirty = true; }
+        }
+        for (size_t i = 0; i < sizeof DIGITOS / sizeof DIGITOS[0]; i++) {
+            if (entrada_apertou(DIGITOS[i].tecla) && idx < maxlen - 1) {
+                buf[idx++] = DIGITOS[i].c;
+                buf[idx] = '\0';
+                dirty = true;
+            }
+        }
+        if (!dirty) entrada_dormir();
+    }
+}
@@ -0,0 +1,31 @@
+/*  src/entrada.h
+    Camada de teclado para MECSOL - TI-84 Plus CE
+    Um só lugar para ler tecla: entrada_scan apresenta o quadro (tela_scan),
+    lê o teclado, guarda o estado anterior para detectar bordas e sai com ON.
+    entrada_linha é o editor numérico usado por centroid, viga e tensões.
+
+    Laços que só esperam tecla chamam entrada_dormir no lugar do antigo
+    kb_Scan + delay(10): o teclado fica em varredura contínua (o controlador
+    atualiza kb_Data sozinho) e a cada ESPERA_MS só se compara o teclado
+    com o último kb_Scan, sem varrer nem redesenhar se nada mudou.
+
+    Autor: https://github.com/daniSoares08
+*/
+
+#ifndef ENTRADA_H
+#define ENTRADA_H
+
+#include <keypadc.h>
+#include <stdbool.h>
+
+void entrada_scan(void);                /* tela_scan + bordas; ON sai do programa  */
+bool entrada_apertou(kb_lkey_t k);      /* desceu entre os dois últimos scans       */
+bool entrada_alguma(void);              /* alguma tecla (fora ON) segurada          */
+void entrada_soltar(void);              /* espera soltar tudo (não propaga tecla)   */
+void entrada_dormir(void);              /* apresenta e espera o teclado mudar       */
+
+/* lê número em buf (dígitos, '.', '-'), desenhado na faixa (x, y, w, 12).
+   CLEAR/DEL apagam, ENTER confirma e só retorna depois de soltar. */
+void entrada_linha(char *buf, int maxlen, int x, int y, int w);
+
+#endif
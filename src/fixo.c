@@ -0,0 +1,213 @@
+/*  src/fixo.c
+    Backend de PONTO FIXO para MECSOL - TI-84 Plus CE (ver fixo.h)
+    Análise de faixa em fixo_viga_montar, uma vez por modelo:
+      x: |x| <= L          -> ex = expoente(L) - FX_XB
+      F: |V| <= Fb         -> eF = expoente(Fb) - FX_FB, com Fb = soma das
+         cargas + limite das reações + momentos/L
+      M: unidade 2^(eF+ex) -> F*dx < 2^47; a soma |M| < 2^(FX_FB+FX_XB+2)
+         fica em 64 bits
+    Cada distribuída vira V = u*(v1 + v2*u), M = u^2*(m2 + m3*u) com
+    u = x - a; inclinação e os fatores 1/2 e 1/6 entram nos coeficientes,
+    que têm expoente próprio (kV, kM) para caber em FX_CB bits. Na avaliação
+    só há produtos coeficiente*u (< 2^47) e deslocamentos, sem divisão.
+    A seção continua em float: Ixx soma w*h^3, e com acumulador de 64 bits
+    sobram só 14 bits por cota (erro ~5e-4, ver bench/); além disso as
+    propriedades já ficam em cache por figura (centroid.c), fora do caminho
+    quente.
+
+    Autor: https://github.com/daniSoares08
+*/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+
+#include "fixo.h"
+
+/* v ~ n*2^e, arredondado */
+static fx2_t quant(real_t v, int e) {
+    return (fx2_t)floor(ldexp(v, -e) + 0.5);
+}
+
+/* v*2^s; s < 0 arredonda */
+static fx48_t desl(fx48_t v, int s) {
+    if (s >= 0) return v * ((fx48_t)1 << s);
+    if (s <= -47) return 0;
+    return (v + ((fx48_t)1 << (-s - 1))) >> -s;
+}
+
+/* e tal que |v| < 2^(e+bits) */
+static int expoente(real_t v, int bits) {
+    int e = 0;
+    if (v > 0.0) frexp(v, &e);
+    return e - bits;
+}
+
+static int nbits(fx2_t v) {
+    int b = 0;
+    if (v < 0) v = -v;
+    while (v) { b++; v >>= 1; }
+    return b;
+}
+
+/* parcela da distribuída i em x: V em unidades de F, M em unidades de M */
+static void dist_em(const FxViga *v, int i, fx_t x, fx2_t *pV, fx2_t *pM) {
+    fx_t u = x - v->d_a[i];
+    *pV = *pM = 0;
+    if (u <= 0) return;
+
+    if (x > v->d_b[i]) {                                   /* além do fim      */
+        *pV = v->d_Ft[i];
+        *pM = (fx48_t)(x - v->d_b[i]) * v->d_Ft[i] + v->d_Mt[i];
+        return;
+    }
+    int nb = v->d_nb[i];
+    fx48_t hV = v->d_v1[i] + desl((fx48_t)v->d_v2[i] * u, -nb);
+    fx48_t hM = v->d_m2[i] + desl((fx48_t)v->d_m3[i] * u, -nb);
+    *pV = desl(hV * u, -v->d_kV[i]);                       /* u*(qa + qx)/2    */
+    *pM = desl(desl(hM * u, -nb) * u, -v->d_kM[i]);        /* u^2*(2qa + qx)/6 */
+}
+
+/* soma das cargas (F) e momento delas em torno de p (M), horário > 0 */
+static void resultantes(const FxViga *v, fx_t p, fx2_t *pF, fx2_t *pM) {
+    fx2_t F = 0, M = 0;
+    for (int i = 0; i < v->np; i++) {
+        F += v->p_F[i];
+        M += (fx2_t)v->p_F[i] * (v->p_pos[i] - p);
+    }
+    for (int i = 0; i < v->nd; i++) {
+        F += v->d_Ft[i];
+        M += (fx2_t)v->d_Ft[i] * (v->d_b[i] - p) - v->d_Mt[i];   /* Mt = Ft*(b - centroide) */
+    }
+    for (int i = 0; i < v->nm; i++) M += v->m_val[i];
+    *pF = F;
+    *pM = M;
+}
+
+bool fixo_viga_montar(const FxModelo *in, FxViga *v) {
+    memset(v, 0, sizeof *v);
+    if (in->L <= 0.0 || in->na < 1 || in->na > FX_MAX_AP) return false;
+
+    /* faixas */
+    real_t Lm = in->L, S = 0.0, Sm = 0.0;
+    for (int i = 0; i < in->na; i++) Lm = fmax(Lm, fabs(in->ap_pos[i]));
+    for (int i = 0; i < in->np; i++) { Lm = fmax(Lm, fabs(in->p_pos[i])); S += fabs(in->p_F[i]); }
+    for (int i = 0; i < in->nd; i++) {
+        Lm = fmax(Lm, fmax(fabs(in->d_a[i]), fabs(in->d_b[i])));
+        S += 0.5 * fabs(in->d_b[i] - in->d_a[i]) * (fabs(in->d_qa[i]) + fabs(in->d_qb[i]));
+    }
+    for (int i = 0; i < in->nm; i++) { Lm = fmax(Lm, fabs(in->m_pos[i])); Sm += fabs(in->m_val[i]); }
+
+    /* |RB| <= (momento das cargas em A)/d, |RA| <= S + |RB| */
+    real_t Fb = S + Sm / Lm;
+    if (in->na == 2) {
+        real_t pa = in->ap_pos[0], d = fabs(in->ap_pos[1] - pa), Ma = Sm;
+        if (d < 1e-6 * Lm) return false;
+        for (int i = 0; i < in->np; i++) Ma += fabs(in->p_F[i] * (in->p_pos[i] - pa));
+        for (int i = 0; i < in->nd; i++)
+            Ma += 0.5 * fabs(in->d_b[i] - in->d_a[i]) * (fabs(in->d_qa[i]) + fabs(in->d_qb[i]))
+                * fmax(fabs(in->d_a[i] - pa), fabs(in->d_b[i] - pa));
+        Fb += S + 2.0 * Ma / d;
+    } else {
+        if (!in->engaste) return false;
+        Fb += S;
+    }
+
+    v->ex = expoente(Lm, FX_XB);
+    v->eF = expoente(Fb, FX_FB);
+
+    /* quantização */
+    v->na = in->na;
+    for (int i = 0; i < in->na; i++) v->ap_pos[i] = (fx_t)quant(in->ap_pos[i], v->ex);
+    v->np = in->np;
+    for (int i = 0; i < in->np; i++) {
+        v->p_pos[i] = (fx_t)quant(in->p_pos[i], v->ex);
+        v->p_F[i]   = (fx_t)quant(in->p_F[i], v->eF);
+    }
+    v->nd = in->nd;
+    real_t g = ldexp(1.0, v->ex - v->eF);                  /* q*u em unidades de F */
+    for (int i = 0; i < in->nd; i++) {
+        v->d_a[i] = (fx_t)quant(in->d_a[i], v->ex);
+        v->d_b[i] = (fx_t)quant(in->d_b[i], v->ex);
+        fx_t Ld = v->d_b[i] - v->d_a[i];
+        if (Ld <= 0) {                                     /* coeficientes ficam 0 */
+            v->d_b[i] = v->d_a[i];
+            continue;
+        }
+        /* V = A1*u + A2*u^2, M = B2*u^2 + B3*u^3 */
+        real_t qa = in->d_qa[i], dq = in->d_qb[i] - qa;
+        real_t A1 = qa * g, A2 = dq / (2.0 * Ld) * g;
+        real_t B2 = 0.5 * qa * g, B3 = dq / (6.0 * Ld) * g;
+        int nb = nbits(Ld);
+        real_t p = ldexp(1.0, nb);
+        int kV = -expoente(fmax(fabs(A1), fabs(A2) * p), FX_CB);
+        int kM = -expoente(fmax(fabs(B2) * p, fabs(B3) * p * p), FX_CB);
+        v->d_nb[i] = nb;
+        v->d_kV[i] = kV;
+        v->d_kM[i] = kM;
+        v->d_v1[i] = (fx_t)quant(A1, -kV);
+        v->d_v2[i] = (fx_t)quant(A2, -kV - nb);
+        v->d_m2[i] = (fx_t)quant(B2, -kM - nb);
+        v->d_m3[i] = (fx_t)quant(B3, -kM - 2*nb);
+        /* resultante e momento em b pelos mesmos coeficientes: sem salto em x = b */
+        fx2_t Vb, Mb;
+        dist_em(v, i, v->d_b[i], &Vb, &Mb);
+        v->d_Ft[i] = (fx_t)Vb;
+        v->d_Mt[i] = Mb;
+    }
+    v->nm = in->nm;
+    for (int i = 0; i < in->nm; i++) {
+        v->m_pos[i] = (fx_t)quant(in->m_pos[i], v->ex);
+        v->m_val[i] = quant(in->m_val[i], v->eF + v->ex);
+    }
+
+    /* reações (mesmas equações de resolver_reacoes) */
+    fx2_t F, M;
+    resultantes(v, v->ap_pos[0], &F, &M);
+    if (v->na == 1) {
+        v->ap_R[0] = (fx_t)F;
+        v->ap_M[0] = -M;
+    } else {
+        fx2_t d = (fx2_t)v->ap_pos[1] - v->ap_pos[0];
+        fx2_t RB = (M >= 0) == (d > 0) ? (M + d/2) / d : (M - d/2) / d;
+        v->ap_R[1] = (fx_t)RB;
+        v->ap_R[0] = (fx_t)(F - RB);
+    }
+    v->ok = true;
+    return true;
+}
+
+void fixo_viga_VM(const FxViga *v, real_t x, real_t *pV, real_t *pM) {
+    fx_t  xn = (fx_t)quant(x, v->ex);
+    fx2_t V = 0, M = 0;
+
+    for (int i = 0; i < v->na; i++) {
+        if (v->ap_pos[i] < xn) {
+            V += v->ap_R[i];
+            M += (fx48_t)v->ap_R[i] * (xn - v->ap_pos[i]) + v->ap_M[i];
+        }
+    }
+    for (int i = 0; i < v->np; i++) {
+        if (v->p_pos[i] <= xn) {
+            V -= v->p_F[i];
+            M -= (fx48_t)v->p_F[i] * (xn - v->p_pos[i]);
+        }
+    }
+    for (int i = 0; i < v->nd; i++) {
+        fx2_t Vd, Md;
+        dist_em(v, i, xn, &Vd, &Md);
+        V -= Vd;
+        M -= Md;
+    }
+    for (int i = 0; i < v->nm; i++)
+        if (v->m_pos[i] <= xn) M += v->m_val[i];
+
+    *pV = ldexp((real_t)V, v->eF);
+    *pM = ldexp((real_t)M, v->eF + v->ex);
+}
+
+void fixo_viga_reacao(const FxViga *v, int i, real_t *Ry, real_t *Ma) {
+    *Ry = ldexp((real_t)v->ap_R[i], v->eF);
+    *Ma = ldexp((real_t)v->ap_M[i], v->eF + v->ex);
+}
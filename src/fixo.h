@@ -0,0 +1,72 @@
+/*  src/fixo.h
+    Backend de PONTO FIXO para MECSOL - TI-84 Plus CE
+    Com MECSOL_FIXO definido (make FIXO=1), reações e V(x)/M(x) saem de
+    inteiros: posições em 22 bits (cabem no int de 24 bits do eZ80), forças
+    em 25 bits e todo produto em 48 bits; só as somas de momento usam 64.
+    Os expoentes de cada grandeza (x, F, q, M) são escolhidos uma vez por
+    modelo a partir dos limites (análise de faixa), então nenhum produto
+    estoura e só a conversão final usa float. A distribuída vira polinômio
+    em dx com coeficientes pré-calculados (sem divisão na avaliação).
+    Precisão contra real_t: bench/. Tempo no eZ80 ainda não foi medido
+    (CEmu): é um backend alternativo, não um caminho rápido comprovado.
+
+    Autor: https://github.com/daniSoares08
+*/
+
+#ifndef FIXO_H
+#define FIXO_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "real.h"
+
+typedef int32_t fx_t;    /* mantissa (long do eZ80)     */
+typedef int64_t fx2_t;   /* somas de momento               */
+#ifdef __INT48_TYPE__
+typedef __INT48_TYPE__ fx48_t;   /* produtos: 48 bits nativos no clang do CEdev */
+#else
+typedef int64_t fx48_t;
+#endif
+
+#define FX_XB 22         /* |x| < 2^22: passo < L/2^21, menor que o EPS dos eventos */
+#define FX_FB 25         /* |F|, |V| < 2^25: F*dx < 2^47                        */
+#define FX_CB 24         /* coeficientes da distribuída < 2^24: c*dx < 2^46     */
+
+#define FX_MAX_AP 2
+#define FX_MAX_P  8
+#define FX_MAX_D  6
+#define FX_MAX_M  6
+
+/* modelo em real_t, preenchido por viga.c (mesmas convenções de sinal) */
+typedef struct {
+    real_t L;
+    int    na;  real_t ap_pos[FX_MAX_AP];  bool engaste;   /* engaste: na == 1 */
+    int    np;  real_t p_pos[FX_MAX_P], p_F[FX_MAX_P];
+    int    nd;  real_t d_a[FX_MAX_D], d_b[FX_MAX_D], d_qa[FX_MAX_D], d_qb[FX_MAX_D];
+    int    nm;  real_t m_pos[FX_MAX_M], m_val[FX_MAX_M];
+} FxModelo;
+
+/* modelo quantizado: x = n*2^ex, F = n*2^eF, M = n*2^(eF+ex).
+   Distribuída i, u = x - a em [0, b-a], u < 2^d_nb[i]:
+     V(u) = (d_v1 + d_v2*u/2^nb) * u / 2^d_kV
+     M(u) = (d_m2 + d_m3*u/2^nb) * u/2^nb * u / 2^d_kM
+   e além de b: V = d_Ft, M = (x - b)*d_Ft + d_Mt. */
+typedef struct {
+    int   ex, eF;
+    int   na;  fx_t ap_pos[FX_MAX_AP], ap_R[FX_MAX_AP];  fx2_t ap_M[FX_MAX_AP];
+    int   np;  fx_t p_pos[FX_MAX_P], p_F[FX_MAX_P];
+    int   nd;  fx_t d_a[FX_MAX_D], d_b[FX_MAX_D];
+    int   d_nb[FX_MAX_D], d_kV[FX_MAX_D], d_kM[FX_MAX_D];
+    fx_t  d_v1[FX_MAX_D], d_v2[FX_MAX_D], d_m2[FX_MAX_D], d_m3[FX_MAX_D];
+    fx_t  d_Ft[FX_MAX_D];  fx2_t d_Mt[FX_MAX_D];
+    int   nm;  fx_t m_pos[FX_MAX_M];  fx2_t m_val[FX_MAX_M];
+    bool  ok;
+} FxViga;
+
+/* quantiza e resolve as reações em inteiros; false se a viga for instável */
+bool fixo_viga_montar(const FxModelo *in, FxViga *v);
+void fixo_viga_VM(const FxViga *v, real_t x, real_t *V, real_t *M);
+void fixo_viga_reacao(const FxViga *v, int i, real_t *Ry, real_t *Ma);
+
+#endif
@@ -15,6 +15,10 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "secao.h"   /* CAMPO_COR0 / CAMPO_NCORES (paleta) */
+#include "tela.h"    /* buffer duplo + regiões sujas */
+#include "entrada.h" /* espera de tecla dormindo */
+
 /* Entradas dos módulos */
 void centroid_module(void);
 void viga_module(void);
@@ -22,7 +26,7 @@ void tensoes_module(void);
 
 /* ON sai imediatamente */
 static inline void check_on_exit(void) {
-    kb_Scan();
+    tela_scan();
     if (kb_On) {
         gfx_End();
         exit(0);
@@ -62,24 +66,22 @@ static uint8_t pressed_once(kb_lkey_t lk) {
 static void wait_enter_or_clear_main(void) {
     while (1) {
         check_on_exit();
-        kb_Scan();
+        tela_scan();
         if (pressed_once(kb_KeyEnter)) return;
         if (pressed_once(kb_KeyClear)) return;
+        entrada_dormir();
     }
 }
 
 /* evita propagar uma tecla segurada para o modulo seguinte */
 static void wait_key_release(void) {
-    do {
-        kb_Scan();
-    } while (kb_Data[1] | kb_Data[2] | kb_Data[3] |
-             kb_Data[4] | kb_Data[5] | kb_Data[6] | kb_Data[7]);
-    delay(15);
+    entrada_soltar();
 }
 
 int main(void) {
     kb_DisableOnLatch();
     gfx_Begin();
+    tela_iniciar();     /* desenha no buffer de trás; o LCD só vê quadros prontos */
 
     /* Paleta:
        0 = branco (fundo)
@@ -89,6 +91,14 @@ int main(void) {
     gfx_palette[1] = gfx_RGBTo1555(0, 0, 0);
     gfx_palette[2] = gfx_RGBTo1555(255, 64, 64);
 
+    /* 16..31 = escala do campo de tensões (azul = compressão, vermelho = tração) */
+    for (int k = 0; k < CAMPO_NCORES; k++) {
+        int t = (k * 2 - (CAMPO_NCORES - 1)) * 255 / (CAMPO_NCORES - 1);   /* -255..255 */
+        uint8_t c = (uint8_t)(255 - (t < 0 ? -t : t));
+        gfx_palette[CAMPO_COR0 + k] = (t < 0) ? gfx_RGBTo1555(c, c, 255)
+                                              : gfx_RGBTo1555(255, c, c);
+    }
+
     gfx_SetTextFGColor(1);
     gfx_SetTextBGColor(0);
     gfx_SetTextTransparentColor(0);
@@ -100,23 +110,23 @@ int main(void) {
         uint8_t key = 0;
 
         /* Tela do menu principal */
-        gfx_FillScreen(0);   /* branco */
+        tela_limpar();   /* branco */
         gfx_SetTextFGColor(1);
 
-        gfx_PrintStringXY("=== MENU PRINCIPAL ===", 2, 2);
-        gfx_PrintStringXY("1) Formato (centroide & Ix)", 2, 18);
-        gfx_PrintStringXY("2) Viga (reacoes & internos)", 2, 30);
-        gfx_PrintStringXY("3) Max. tensoes", 2, 42);
-        gfx_PrintStringXY("4) Sair", 2, 54);
+        tela_texto("=== MENU PRINCIPAL ===", 2, 2);
+        tela_texto("1) Formato (centroide & Ix)", 2, 18);
+        tela_texto("2) Viga (reacoes & internos)", 2, 30);
+        tela_texto("3) Max. tensoes", 2, 42);
+        tela_texto("4) Sair", 2, 54);
         while (!key) {
             check_on_exit();
-            kb_Scan();
+            tela_scan();
 
             if (pressed_once(kb_Key1)) key = 1;
             else if (pressed_once(kb_Key2)) key = 2;
             else if (pressed_once(kb_Key3)) key = 3;
             else if (pressed_once(kb_Key4)) key = 4;
-            delay(15); /* precisa disso pra tirar o flicker */
+            else entrada_dormir();
         }
 
         if (key == 1) {
@@ -0,0 +1,94 @@
+/*  src/perfis.c
+    Catálogo de PERFIS padrão (W/IPE/HEA, UPN, cantoneiras, madeira) para MECSOL - TI-84 Plus CE
+    As tabelas são geradas em tempo de build (tools/gen_perfis.py -> perfis_tab.h)
+    e ficam só em memória de programa (const, arquivado). Nada é calculado aqui:
+    busca por nome é binária na tabela alfabética; busca por S ou peso usa os
+    índices ordenados gerados junto.
+
+    Autor: https://github.com/daniSoares08
+*/
+
+#include <stdint.h>
+#include <string.h>
+
+#include "secao.h"
+#include "perfis_tab.h"
+
+int perfis_total(void) {
+    return N_PERFIS;
+}
+
+/* i-ésimo perfil em ordem alfabética */
+const Perfil *perfis_get(int i) {
+    if (i < 0 || i >= N_PERFIS) return NULL;
+    return &PERFIS[i];
+}
+
+/* k-ésimo perfil em ordem crescente de S (módulo elástico mínimo) */
+const Perfil *perfis_por_S(int k) {
+    if (k < 0 || k >= N_PERFIS) return NULL;
+    return &PERFIS[IDX_S[k]];
+}
+
+/* k-ésimo perfil em ordem crescente de massa por metro */
+const Perfil *perfis_por_peso(int k) {
+    if (k < 0 || k >= N_PERFIS) return NULL;
+    return &PERFIS[IDX_PESO[k]];
+}
+
+/* índice alfabético do perfil com esse nome, ou -1 */
+int perfis_busca_nome(const char *nome) {
+    int lo = 0, hi = N_PERFIS - 1;
+    while (lo <= hi) {
+        int m = (lo + hi) / 2;
+        int c = strcmp(nome, PERFIS[m].nome);
+        if (c == 0) return m;
+        if (c < 0) hi = m - 1; else lo = m + 1;
+    }
+    return -1;
+}
+
+/* primeira posição (na ordem de S) com S >= S_min */
+static int primeiro_S(real_t S_min) {
+    int lo = 0, hi = N_PERFIS;
+    while (lo < hi) {
+        int m = (lo + hi) / 2;
+        if (PERFIS[IDX_S[m]].S < S_min) lo = m + 1; else hi = m;
+    }
+    return lo;
+}
+
+/* perfis com S_min <= S <= S_max: devolve a quantidade e grava em *pk a
+   primeira posição para usar com perfis_por_S() */
+int perfis_faixa_S(real_t S_min, real_t S_max, int *pk) {
+    int a = primeiro_S(S_min);
+    int b = primeiro_S(S_max);
+    while (b < N_PERFIS && PERFIS[IDX_S[b]].S <= S_max) b++;
+    if (pk) *pk = a;
+    return b - a;
+}
+
+/* decomposição em retângulos (m), origem no canto inferior esquerdo;
+   mesma geometria usada pelo gerador das tabelas */
+int perfis_retangulos(const Perfil *p, Rect *out) {
+    real_t d = p->d, bf = p->bf, tw = p->tw, tf = p->tf;
+    switch (p->tipo) {
+        case PERFIL_I:
+            out[0] = (Rect){ 0, bf, tf, 0.0, 0.0 };
+            out[1] = (Rect){ 0, tw, d - 2.0*tf, (bf - tw) / 2.0, tf };
+            out[2] = (Rect){ 0, bf, tf, 0.0, d - tf };
+            return 3;
+        case PERFIL_U:
+            out[0] = (Rect){ 0, bf, tf, 0.0, 0.0 };
+            out[1] = (Rect){ 0, tw, d - 2.0*tf, 0.0, tf };
+            out[2] = (Rect){ 0, bf, tf, 0.0, d - tf };
+            return 3;
+        case PERFIL_L:
+            out[0] = (Rect){ 0, bf, tf, 0.0, 0.0 };
+            out[1] = (Rect){ 0, tw, d - tf, 0.0, tf };
+            return 2;
+        default:
+            out[0] = (Rect){ 0, bf, d, 0.0, 0.0 };
+            return 1;
+    }
+}
@@ -0,0 +1,100 @@
+/*  src/perfis_tab.h
+    GERADO por tools/gen_perfis.py a partir de tools/perfis.csv - nao editar.
+    Incluido apenas por perfis.c.
+*/
+
+#define N_PERFIS 73
+
+/* ordem alfabetica (busca binaria por nome) */
+static const Perfil PERFIS[N_PERFIS] = {
+    {"2X10", PERFIL_R, MAT_MADEIRA, 2.350000e-01f, 3.800000e-02f, 0.000000e+00f, 0.000000e+00f, 8.930000e-03f, 4.109660e-05f, 1.074577e-06f, 3.497583e-04f, 5.246375e-04f, 1.679731e+02f, 5.358000e+00f},
+    {"2X12", PERFIL_R, MAT_MADEIRA, 2.860000e-01f, 3.800000e-02f, 0.000000e+00f, 0.000000e+00f, 1.086800e-02f, 7.407991e-05f, 1.307783e-06f, 5.180413e-04f, 7.770620e-04f, 1.380199e+02f, 6.520800e+00f},
+    {"2X4", PERFIL_R, MAT_MADEIRA, 8.900000e-02f, 3.800000e-02f, 0.000000e+00f, 0.000000e+00f, 3.382000e-03f, 2.232402e-06f, 4.069673e-07f, 5.016633e-05f, 7.524950e-05f, 4.435245e+02f, 2.029200e+00f},
+    {"2X6", PERFIL_R, MAT_MADEIRA, 1.400000e-01f, 3.800000e-02f, 0.000000e+00f, 0.000000e+00f, 5.320000e-03f, 8.689333e-06f, 6.401733e-07f, 1.241333e-04f, 1.862000e-04f, 2.819549e+02f, 3.192000e+00f},
+    {"2X8", PERFIL_R, MAT_MADEIRA, 1.840000e-01f, 3.800000e-02f, 0.000000e+00f, 0.000000e+00f, 6.992000e-03f, 1.972676e-05f, 8.413707e-07f, 2.144213e-04f, 3.216320e-04f, 2.145309e+02f, 4.195200e+00f},
+    {"HEA100", PERFIL_I, MAT_ACO, 9.600000e-02f, 1.000000e-01f, 5.000000e-03f, 8.000000e-03f, 2.000000e-03f, 3.319467e-06f, 1.334167e-06f, 6.915556e-05f, 7.840000e-05f, 2.361825e+03f, 1.570000e+01f},
+    {"HEA120", PERFIL_I, MAT_ACO, 1.140000e-01f, 1.200000e-01f, 5.000000e-03f, 8.000000e-03f, 2.410000e-03f, 5.795683e-06f, 2.305021e-06f, 1.016787e-04f, 1.137650e-04f, 1.962926e+03f, 1.891850e+01f},
+    {"HEA140", PERFIL_I, MAT_ACO, 1.330000e-01f, 1.400000e-01f, 5.500000e-03f, 8.500000e-03f, 3.018000e-03f, 9.952389e-06f, 3.888942e-06f, 1.496600e-04f, 1.666570e-04f, 1.522312e+03f, 2.369130e+01f},
+    {"HEA160", PERFIL_I, MAT_ACO, 1.520000e-01f, 1.600000e-01f, 6.000000e-03f, 9.000000e-03f, 3.684000e-03f, 1.594577e-05f, 6.146412e-06f, 2.098128e-04f, 2.328540e-04f, 1.216906e+03f, 2.891940e+01f},
+    {"HEA180", PERFIL_I, MAT_ACO, 1.710000e-01f, 1.800000e-01f, 6.000000e-03f, 9.500000e-03f, 4.332000e-03f, 2.408195e-05f, 9.236736e-06f, 2.816602e-04f, 3.108210e-04f, 1.075567e+03f, 3.400620e+01f},
+    {"HEA200", PERFIL_I, MAT_ACO, 1.900000e-01f, 2.000000e-01f, 6.500000e-03f, 1.000000e-02f, 5.105000e-03f, 3.509454e-05f, 1.333722e-05f, 3.694162e-04f, 4.069625e-04f, 8.920136e+02f, 4.007425e+01f},
+    {"HEA220", PERFIL_I, MAT_ACO, 2.100000e-01f, 2.200000e-01f, 7.000000e-03f, 1.100000e-02f, 6.156000e-03f, 5.184207e-05f, 1.952671e-05f, 4.937340e-04f, 5.434320e-04f, 7.487465e+02f, 4.832460e+01f},
+    {"HEA240", PERFIL_I, MAT_ACO, 2.300000e-01f, 2.400000e-01f, 7.500000e-03f, 1.200000e-02f, 7.305000e-03f, 7.396731e-05f, 2.765524e-05f, 6.431940e-04f, 7.074075e-04f, 6.375857e+02f, 5.734425e+01f},
+    {"HEA260", PERFIL_I, MAT_ACO, 2.500000e-01f, 2.600000e-01f, 7.500000e-03f, 1.250000e-02f, 8.187500e-03f, 9.886393e-05f, 3.662458e-05f, 7.909115e-04f, 8.667969e-04f, 5.845050e+02f, 6.427188e+01f},
+    {"HEA280", PERFIL_I, MAT_ACO, 2.700000e-01f, 2.800000e-01f, 8.000000e-03f, 1.300000e-02f, 9.232000e-03f, 1.299962e-04f, 4.757308e-05f, 9.629350e-04f, 1.054552e-03f, 5.070109e+02f, 7.247120e+01f},
+    {"HEA300", PERFIL_I, MAT_ACO, 2.900000e-01f, 3.000000e-01f, 8.500000e-03f, 1.400000e-02f, 1.062700e-02f, 1.728460e-04f, 6.301341e-05f, 1.192041e-03f, 1.305069e-03f, 4.441453e+02f, 8.342195e+01f},
+    {"IPE100", PERFIL_I, MAT_ACO, 1.000000e-01f, 5.500000e-02f, 4.100000e-03f, 5.700000e-03f, 9.902600e-04f, 1.633227e-06f, 1.585651e-07f, 3.266454e-05f, 3.760926e-05f, 2.808241e+03f, 7.773541e+00f},
+    {"IPE120", PERFIL_I, MAT_ACO, 1.200000e-01f, 6.400000e-02f, 4.400000e-03f, 6.300000e-03f, 1.278960e-03f, 3.063128e-06f, 2.760136e-07f, 5.105214e-05f, 5.853208e-05f, 2.171431e+03f, 1.003984e+01f},
+    {"IPE140", PERFIL_I, MAT_ACO, 1.400000e-01f, 7.300000e-02f, 4.700000e-03f, 6.900000e-03f, 1.600540e-03f, 5.252891e-06f, 4.484614e-07f, 7.504129e-05f, 8.575604e-05f, 1.736755e+03f, 1.256424e+01f},
+    {"IPE160", PERFIL_I, MAT_ACO, 1.600000e-01f, 8.200000e-02f, 5.000000e-03f, 7.400000e-03f, 1.939600e-03f, 8.346265e-06f, 6.815330e-07f, 1.043283e-04f, 1.189515e-04f, 1.425206e+03f, 1.522586e+01f},
+    {"IPE180", PERFIL_I, MAT_ACO, 1.800000e-01f, 9.100000e-02f, 5.300000e-03f, 8.000000e-03f, 2.325200e-03f, 1.272451e-05f, 1.006796e-06f, 1.413834e-04f, 1.608532e-04f, 1.192567e+03f, 1.825282e+01f},
+    {"IPE200", PERFIL_I, MAT_ACO, 2.000000e-01f, 1.000000e-01f, 5.600000e-03f, 8.500000e-03f, 2.724800e-03f, 1.845590e-05f, 1.419345e-06f, 1.845590e-04f, 2.096596e-04f, 1.014288e+03f, 2.138968e+01f},
+    {"IPE220", PERFIL_I, MAT_ACO, 2.200000e-01f, 1.100000e-01f, 5.900000e-03f, 9.200000e-03f, 3.213440e-03f, 2.652771e-05f, 2.044317e-06f, 2.411610e-04f, 2.732774e-04f, 8.730155e+02f, 2.522550e+01f},
+    {"IPE240", PERFIL_I, MAT_ACO, 2.400000e-01f, 1.200000e-01f, 6.200000e-03f, 9.800000e-03f, 3.718480e-03f, 3.670967e-05f, 2.826777e-06f, 3.059139e-04f, 3.460082e-04f, 7.601237e+02f, 2.919007e+01f},
+    {"IPE270", PERFIL_I, MAT_ACO, 2.700000e-01f, 1.350000e-01f, 6.600000e-03f, 1.020000e-02f, 4.401360e-03f, 5.504747e-05f, 4.188617e-06f, 4.077590e-04f, 4.605399e-04f, 6.338054e+02f, 3.455068e+01f},
+    {"IPE300", PERFIL_I, MAT_ACO, 3.000000e-01f, 1.500000e-01f, 7.100000e-03f, 1.070000e-02f, 5.188060e-03f, 7.998987e-05f, 6.027060e-06f, 5.332658e-04f, 6.020984e-04f, 5.300833e+02f, 4.072627e+01f},
+    {"IPE330", PERFIL_I, MAT_ACO, 3.300000e-01f, 1.600000e-01f, 7.500000e-03f, 1.150000e-02f, 5.982500e-03f, 1.114515e-04f, 7.861460e-06f, 6.754634e-04f, 7.627569e-04f, 4.562566e+02f, 4.696263e+01f},
+    {"IPE360", PERFIL_I, MAT_ACO, 3.600000e-01f, 1.700000e-01f, 8.000000e-03f, 1.270000e-02f, 6.994800e-03f, 1.552383e-04f, 1.041346e-05f, 8.624351e-04f, 9.737350e-04f, 3.920323e+02f, 5.490918e+01f},
+    {"IPE400", PERFIL_I, MAT_ACO, 4.000000e-01f, 1.800000e-01f, 8.600000e-03f, 1.350000e-02f, 8.067800e-03f, 2.187647e-04f, 1.314177e-05f, 1.093824e-03f, 1.238322e-03f, 3.291000e+02f, 6.333223e+01f},
+    {"IPE450", PERFIL_I, MAT_ACO, 4.500000e-01f, 1.900000e-01f, 9.400000e-03f, 1.460000e-02f, 9.503520e-03f, 3.214044e-04f, 1.671936e-05f, 1.428464e-03f, 1.623920e-03f, 2.687541e+02f, 7.460263e+01f},
+    {"IPE500", PERFIL_I, MAT_ACO, 5.000000e-01f, 2.000000e-01f, 1.020000e-02f, 1.600000e-02f, 1.117360e-02f, 4.620739e-04f, 2.137472e-05f, 1.848296e-03f, 2.107311e-03f, 2.235564e+02f, 8.771276e+01f},
+    {"IPE550", PERFIL_I, MAT_ACO, 5.500000e-01f, 2.100000e-01f, 1.110000e-02f, 1.720000e-02f, 1.294716e-02f, 6.396465e-04f, 2.660696e-05f, 2.325987e-03f, 2.662189e-03f, 1.874761e+02f, 1.016352e+02f},
+    {"IPE600", PERFIL_I, MAT_ACO, 6.000000e-01f, 2.200000e-01f, 1.200000e-02f, 1.900000e-02f, 1.510400e-02f, 8.832583e-04f, 3.379959e-05f, 2.944194e-03f, 3.376112e-03f, 1.592641e+02f, 1.185664e+02f},
+    {"IPE80", PERFIL_I, MAT_ACO, 8.000000e-02f, 4.600000e-02f, 3.800000e-03f, 5.200000e-03f, 7.428800e-04f, 7.770101e-07f, 8.467612e-08f, 1.942525e-05f, 2.249411e-05f, 3.809155e+03f, 5.831608e+00f},
+    {"L100X10", PERFIL_L, MAT_ACO, 1.000000e-01f, 1.000000e-01f, 1.000000e-02f, 1.000000e-02f, 1.900000e-03f, 1.800044e-06f, 1.800044e-06f, 2.524047e-05f, 4.547500e-05f, 1.412727e+03f, 1.491500e+01f},
+    {"L120X12", PERFIL_L, MAT_ACO, 1.200000e-01f, 1.200000e-01f, 1.200000e-02f, 1.200000e-02f, 2.736000e-03f, 3.732571e-06f, 3.732571e-06f, 4.361553e-05f, 7.858080e-05f, 9.810606e+02f, 2.147760e+01f},
+    {"L40X4", PERFIL_L, MAT_ACO, 4.000000e-02f, 4.000000e-02f, 4.000000e-03f, 4.000000e-03f, 3.040000e-04f, 4.608112e-08f, 4.608112e-08f, 1.615390e-06f, 2.910400e-06f, 8.829545e+03f, 2.386400e+00f},
+    {"L50X5", PERFIL_L, MAT_ACO, 5.000000e-02f, 5.000000e-02f, 5.000000e-03f, 5.000000e-03f, 4.750000e-04f, 1.125027e-07f, 1.125027e-07f, 3.155058e-06f, 5.684375e-06f, 5.650909e+03f, 3.728750e+00f},
+    {"L60X6", PERFIL_L, MAT_ACO, 6.000000e-02f, 6.000000e-02f, 6.000000e-03f, 6.000000e-03f, 6.840000e-04f, 2.332857e-07f, 2.332857e-07f, 5.451941e-06f, 9.822600e-06f, 3.924242e+03f, 5.369400e+00f},
+    {"L75X8", PERFIL_L, MAT_ACO, 7.500000e-02f, 7.500000e-02f, 8.000000e-03f, 8.000000e-03f, 1.136000e-03f, 6.018161e-07f, 6.018161e-07f, 1.128977e-05f, 2.034235e-05f, 2.360826e+03f, 8.917600e+00f},
+    {"L80X8", PERFIL_L, MAT_ACO, 8.000000e-02f, 8.000000e-02f, 8.000000e-03f, 8.000000e-03f, 1.216000e-03f, 7.372980e-07f, 7.372980e-07f, 1.292312e-05f, 2.328320e-05f, 2.207386e+03f, 9.545600e+00f},
+    {"MAD10X20", PERFIL_R, MAT_MADEIRA, 2.000000e-01f, 1.000000e-01f, 0.000000e+00f, 0.000000e+00f, 2.000000e-02f, 6.666667e-05f, 1.666667e-05f, 6.666667e-04f, 1.000000e-03f, 7.500000e+01f, 1.200000e+01f},
+    {"MAD5X7", PERFIL_R, MAT_MADEIRA, 7.000000e-02f, 5.000000e-02f, 0.000000e+00f, 0.000000e+00f, 3.500000e-03f, 1.429167e-06f, 7.291667e-07f, 4.083333e-05f, 6.125000e-05f, 4.285714e+02f, 2.100000e+00f},
+    {"MAD6X12", PERFIL_R, MAT_MADEIRA, 1.200000e-01f, 6.000000e-02f, 0.000000e+00f, 0.000000e+00f, 7.200000e-03f, 8.640000e-06f, 2.160000e-06f, 1.440000e-04f, 2.160000e-04f, 2.083333e+02f, 4.320000e+00f},
+    {"MAD6X16", PERFIL_R, MAT_MADEIRA, 1.600000e-01f, 6.000000e-02f, 0.000000e+00f, 0.000000e+00f, 9.600000e-03f, 2.048000e-05f, 2.880000e-06f, 2.560000e-04f, 3.840000e-04f, 1.562500e+02f, 5.760000e+00f},
+    {"MAD8X16", PERFIL_R, MAT_MADEIRA, 1.600000e-01f, 8.000000e-02f, 0.000000e+00f, 0.000000e+00f, 1.280000e-02f, 2.730667e-05f, 6.826667e-06f, 3.413333e-04f, 5.120000e-04f, 1.171875e+02f, 7.680000e+00f},
+    {"MAD8X20", PERFIL_R, MAT_MADEIRA, 2.000000e-01f, 8.000000e-02f, 0.000000e+00f, 0.000000e+00f, 1.600000e-02f, 5.333333e-05f, 8.533333e-06f, 5.333333e-04f, 8.000000e-04f, 9.375000e+01f, 9.600000e+00f},
+    {"UPN100", PERFIL_U, MAT_ACO, 1.000000e-01f, 5.000000e-02f, 6.000000e-03f, 8.500000e-03f, 1.348000e-03f, 2.070114e-06f, 3.305634e-07f, 4.140229e-05f, 4.922100e-05f, 1.981412e+03f, 1.058180e+01f},
+    {"UPN120", PERFIL_U, MAT_ACO, 1.200000e-01f, 5.500000e-02f, 7.000000e-03f, 9.000000e-03f, 1.704000e-03f, 3.675168e-06f, 4.914166e-07f, 6.125280e-05f, 7.315200e-05f, 1.421743e+03f, 1.337640e+01f},
+    {"UPN140", PERFIL_U, MAT_ACO, 1.400000e-01f, 6.000000e-02f, 7.000000e-03f, 1.000000e-02f, 2.040000e-03f, 6.088000e-06f, 7.104241e-07f, 8.697143e-05f, 1.032000e-04f, 1.210813e+03f, 1.601400e+01f},
+    {"UPN160", PERFIL_U, MAT_ACO, 1.600000e-01f, 6.500000e-02f, 7.500000e-03f, 1.050000e-02f, 2.407500e-03f, 9.318076e-06f, 9.740407e-07f, 1.164759e-04f, 1.382606e-04f, 9.891930e+02f, 1.889888e+01f},
+    {"UPN180", PERFIL_U, MAT_ACO, 1.800000e-01f, 7.000000e-02f, 8.000000e-03f, 1.100000e-02f, 2.804000e-03f, 1.364105e-05f, 1.302709e-06f, 1.515673e-04f, 1.800580e-04f, 8.249820e+02f, 2.201140e+01f},
+    {"UPN200", PERFIL_U, MAT_ACO, 2.000000e-01f, 7.500000e-02f, 8.500000e-03f, 1.150000e-02f, 3.229500e-03f, 1.927017e-05f, 1.706095e-06f, 1.927017e-04f, 2.291554e-04f, 6.995128e+02f, 2.535158e+01f},
+    {"UPN220", PERFIL_U, MAT_ACO, 2.200000e-01f, 8.000000e-02f, 9.000000e-03f, 1.250000e-02f, 3.755000e-03f, 2.711532e-05f, 2.256536e-06f, 2.465029e-04f, 2.930563e-04f, 6.004318e+02f, 2.947675e+01f},
+    {"UPN240", PERFIL_U, MAT_ACO, 2.400000e-01f, 8.500000e-02f, 9.500000e-03f, 1.300000e-02f, 4.243000e-03f, 3.625950e-05f, 2.854899e-06f, 3.021625e-04f, 3.596005e-04f, 5.219692e+02f, 3.330755e+01f},
+    {"UPN80", PERFIL_U, MAT_ACO, 8.000000e-02f, 4.500000e-02f, 6.000000e-03f, 8.000000e-03f, 1.104000e-03f, 1.068032e-06f, 2.178798e-07f, 2.670080e-05f, 3.206400e-05f, 2.501798e+03f, 8.666400e+00f},
+    {"W150X13", PERFIL_I, MAT_ACO, 1.480000e-01f, 1.000000e-01f, 4.300000e-03f, 4.900000e-03f, 1.574260e-03f, 5.964801e-06f, 8.175823e-07f, 8.060543e-05f, 9.065068e-05f, 1.767163e+03f, 1.235794e+01f},
+    {"W150X18", PERFIL_I, MAT_ACO, 1.530000e-01f, 1.020000e-01f, 5.800000e-03f, 7.100000e-03f, 2.253440e-03f, 9.006493e-06f, 1.258020e-06f, 1.177319e-04f, 1.335957e-04f, 1.278730e+03f, 1.768950e+01f},
+    {"W200X15", PERFIL_I, MAT_ACO, 2.000000e-01f, 1.000000e-01f, 4.300000e-03f, 5.200000e-03f, 1.855280e-03f, 1.231089e-05f, 8.679229e-07f, 1.231089e-04f, 1.399403e-04f, 1.321767e+03f, 1.456395e+01f},
+    {"W200X19.3", PERFIL_I, MAT_ACO, 2.030000e-01f, 1.020000e-01f, 5.800000e-03f, 6.500000e-03f, 2.428000e-03f, 1.611981e-05f, 1.152731e-06f, 1.588159e-04f, 1.826245e-04f, 9.766547e+02f, 1.905980e+01f},
+    {"W200X26.6", PERFIL_I, MAT_ACO, 2.070000e-01f, 1.330000e-01f, 5.800000e-03f, 8.400000e-03f, 3.337560e-03f, 2.537108e-05f, 3.296784e-06f, 2.451312e-04f, 2.743312e-04f, 9.321337e+02f, 2.619985e+01f},
+    {"W250X17.9", PERFIL_I, MAT_ACO, 2.510000e-01f, 1.010000e-01f, 4.800000e-03f, 5.300000e-03f, 2.224520e-03f, 2.171743e-05f, 9.123147e-07f, 1.730472e-04f, 2.008738e-04f, 9.634822e+02f, 1.746248e+01f},
+    {"W250X25.3", PERFIL_I, MAT_ACO, 2.570000e-01f, 1.020000e-01f, 6.100000e-03f, 8.400000e-03f, 3.178820e-03f, 3.353082e-05f, 1.490235e-06f, 2.609402e-04f, 3.009869e-04f, 7.357727e+02f, 2.495374e+01f},
+    {"W250X32.7", PERFIL_I, MAT_ACO, 2.580000e-01f, 1.460000e-01f, 6.100000e-03f, 9.100000e-03f, 4.119980e-03f, 4.818217e-05f, 4.724609e-06f, 3.735052e-04f, 4.183822e-04f, 7.117492e+02f, 3.234184e+01f},
+    {"W310X21", PERFIL_I, MAT_ACO, 3.030000e-01f, 1.010000e-01f, 5.100000e-03f, 5.700000e-03f, 2.638560e-03f, 3.598324e-05f, 9.820094e-07f, 2.375131e-04f, 2.795696e-04f, 7.617097e+02f, 2.071270e+01f},
+    {"W310X28.3", PERFIL_I, MAT_ACO, 3.090000e-01f, 1.020000e-01f, 6.000000e-03f, 8.900000e-03f, 3.562800e-03f, 5.323673e-05f, 1.579367e-06f, 3.445743e-04f, 3.996269e-04f, 6.255502e+02f, 2.796798e+01f},
+    {"W310X38.7", PERFIL_I, MAT_ACO, 3.100000e-01f, 1.650000e-01f, 5.800000e-03f, 9.700000e-03f, 4.886480e-03f, 8.405305e-05f, 7.266994e-06f, 5.422777e-04f, 6.030803e-04f, 6.185341e+02f, 3.835887e+01f},
+    {"W360X32.9", PERFIL_I, MAT_ACO, 3.490000e-01f, 1.270000e-01f, 5.800000e-03f, 8.500000e-03f, 4.084600e-03f, 8.027903e-05f, 2.907274e-06f, 4.600517e-04f, 5.273946e-04f, 5.663378e+02f, 3.206411e+01f},
+    {"W360X39", PERFIL_I, MAT_ACO, 3.530000e-01f, 1.280000e-01f, 6.500000e-03f, 1.070000e-02f, 4.894600e-03f, 1.000141e-04f, 3.747510e-06f, 5.666519e-04f, 6.474967e-04f, 4.980044e+02f, 3.842261e+01f},
+    {"W410X38.8", PERFIL_I, MAT_ACO, 3.990000e-01f, 1.400000e-01f, 6.400000e-03f, 8.800000e-03f, 4.904960e-03f, 1.233953e-04f, 4.032865e-06f, 6.185230e-04f, 7.134719e-04f, 4.517188e+02f, 3.850394e+01f},
+    {"W410X46.1", PERFIL_I, MAT_ACO, 4.030000e-01f, 1.400000e-01f, 7.000000e-03f, 1.120000e-02f, 5.800200e-03f, 1.525430e-04f, 5.133012e-06f, 7.570371e-04f, 8.678410e-04f, 4.063684e+02f, 4.553157e+01f},
+    {"W460X52", PERFIL_I, MAT_ACO, 4.500000e-01f, 1.520000e-01f, 7.600000e-03f, 1.080000e-02f, 6.539040e-03f, 2.081559e-04f, 6.336926e-06f, 9.251373e-04f, 1.069691e-03f, 3.380852e+02f, 5.133146e+01f},
+    {"W530X66", PERFIL_I, MAT_ACO, 5.250000e-01f, 1.650000e-01f, 8.900000e-03f, 1.140000e-02f, 8.231580e-03f, 3.420680e-04f, 8.564540e-06f, 1.303116e-03f, 1.527237e-03f, 2.508269e+02f, 6.461790e+01f},
+};
+
+static const uint8_t IDX_S[N_PERFIS] = {
+    36, 37, 38, 39, 40, 33, 34, 55, 16, 42, 47, 35, 2, 17, 48, 5,
+    18, 56, 49, 6, 19, 50, 57, 58, 3, 20, 43, 7, 51, 59, 61, 21,
+    52, 8, 4, 64, 22, 60, 53, 44, 62, 9, 54, 23, 45, 65, 0, 10,
+    63, 24, 67, 11, 1, 25, 46, 66, 68, 69, 12, 41, 26, 70, 13, 27,
+    71, 14, 28, 15, 72, 29, 30, 31, 32,
+};
+
+static const uint8_t IDX_PESO[N_PERFIS] = {
+    2, 42, 36, 3, 37, 4, 43, 0, 38, 44, 33, 1, 45, 16, 55, 39,
+    40, 46, 17, 47, 41, 56, 18, 48, 58, 34, 19, 5, 49, 61, 57, 20,
+    50, 6, 59, 64, 21, 35, 51, 7, 62, 22, 52, 60, 65, 8, 23, 53,
+    67, 63, 54, 9, 24, 66, 68, 69, 10, 25, 70, 26, 11, 71, 27, 12,
+    28, 13, 72, 14, 29, 15, 30, 31, 32,
+};
+
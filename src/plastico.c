@@ -0,0 +1,115 @@
+/*  src/plastico.c
+    Módulo PLASTICO (linha neutra plástica e módulo Z) para MECSOL - TI-84 Plus CE
+    Perfil de larguras b(y) da união (uniao.c) em faixas ordenadas por y,
+    somas de prefixo de área e momento estático -> cada consulta é uma
+    busca binária, O(log n).
+
+    Autor: https://github.com/daniSoares08
+*/
+
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+
+#include "secao.h"
+
+#define MAX_FAIXAS (2*UNIAO_MAX_RECT)
+
+static Faixa fx[MAX_FAIXAS];            /* faixas em y: [a,b], m0 = largura b */
+static real_t PA[MAX_FAIXAS + 1];       /* área abaixo de fx[k].a            */
+static real_t PQ[MAX_FAIXAS + 1];       /* Int y dA abaixo de fx[k].a        */
+static int nfx = 0;
+static unsigned rev_ok = 0;
+static bool ok = false;
+
+/* refaz o perfil só quando a figura mudou (revisão do centroid.c) */
+static bool preparar(void) {
+    unsigned rev = centroid_get_revisao();
+    if (ok && rev == rev_ok) return nfx > 0;
+
+    int n = 0;
+    const Rect *r = centroid_get_rects(&n);
+    nfx = uniao_faixas(r, n, 1, fx, MAX_FAIXAS);
+
+    PA[0] = PQ[0] = 0.0;
+    for (int k = 0; k < nfx; k++) {
+        real_t h = fx[k].b - fx[k].a;
+        real_t A = fx[k].m0 * h;
+        PA[k+1] = PA[k] + A;
+        PQ[k+1] = PQ[k] + A * 0.5 * (fx[k].a + fx[k].b);
+    }
+    rev_ok = rev;
+    ok = true;
+    return nfx > 0;
+}
+
+/* faixa que contém a área acumulada alvo (PA[k] <= alvo <= PA[k+1]) */
+static int faixa_da_area(real_t alvo) {
+    int lo = 0, hi = nfx - 1;
+    while (lo < hi) {
+        int m = (lo + hi) / 2;
+        if (PA[m+1] < alvo) lo = m + 1; else hi = m;
+    }
+    return lo;
+}
+
+/* corta a seção na altura em que a área abaixo vale A_abaixo;
+   devolve y e o momento estático Int y dA da parte de baixo */
+static real_t cortar(real_t A_abaixo, real_t *Q_abaixo) {
+    int k = faixa_da_area(A_abaixo);
+    real_t b = fx[k].m0;
+    real_t dA = A_abaixo - PA[k];
+    real_t y = (b > 0.0) ? fx[k].a + dA / b : fx[k].a;
+    if (y > fx[k].b) y = fx[k].b;
+    if (Q_abaixo) *Q_abaixo = PQ[k] + dA * 0.5 * (fx[k].a + y);
+    return y;
+}
+
+real_t plastico_area_total(void) {
+    return preparar() ? PA[nfx] : 0.0;
+}
+
+/* linha neutra plástica (área igual em cima e embaixo) e Z = Int |y - y_p| dA */
+bool plastico_calcular(real_t *y_pna, real_t *Z) {
+    if (!preparar() || PA[nfx] <= 0.0) return false;
+    real_t A = PA[nfx], Q = PQ[nfx];
+    real_t Qb;
+    real_t yp = cortar(0.5 * A, &Qb);
+    if (y_pna) *y_pna = yp;
+    if (Z)     *Z = Q - 2.0 * Qb;    /* (Q - Qb) - Qb; termos em y_p se cancelam */
+    return true;
+}
+
+/* Momento plástico com força normal N (tração > 0), em torno do centroide
+   elástico y_bar. Tração embaixo / compressão em cima (M > 0 = sagging).
+   Exige |N| <= fy*A; devolve a linha neutra em *y_ln. O(log n). */
+real_t plastico_Mp_N(real_t fy, real_t N, real_t *y_ln) {
+    if (!preparar() || fy <= 0.0 || PA[nfx] <= 0.0) {
+        if (y_ln) *y_ln = 0.0;
+        return 0.0;
+    }
+    real_t A = PA[nfx], Q = PQ[nfx];
+    real_t At = 0.5 * (A + N / fy);          /* área tracionada (embaixo) */
+    if (At < 0.0) At = 0.0;
+    if (At > A)   At = A;
+
+    real_t Qb;
+    real_t yn = cortar(At, &Qb);
+    real_t ybar = Q / A;
+    if (y_ln) *y_ln = yn;
+
+    /* fy * [ Int_cima (y - ybar) dA - Int_baixo (y - ybar) dA ] */
+    return fy * ((Q - Qb - ybar * (A - At)) - (Qb - ybar * At));
+}
+
+/* curva de interação M_p(N) com n pontos de -N_p a +N_p (N_p = fy*A) */
+int plastico_curva(real_t fy, int n, real_t *Ns, real_t *Ms) {
+    if (n < 2 || !preparar() || fy <= 0.0) return 0;
+    real_t Np = fy * PA[nfx];
+    for (int i = 0; i < n; i++) {
+        real_t N = -Np + 2.0 * Np * (real_t)i / (real_t)(n - 1);
+        Ns[i] = N;
+        Ms[i] = plastico_Mp_N(fy, N, NULL);
+    }
+    return n;
+}
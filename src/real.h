@@ -0,0 +1,25 @@
+/*  src/real.h
+    Tipo escalar do MECSOL - TI-84 Plus CE, escolhido na compilação
+    Todo núcleo de cálculo usa real_t. Padrão: double. Com MECSOL_REAL_FLOAT
+    (make REAL=float) vira float e <tgmath.h> troca sqrt/fabs/pow/... pelas
+    versões float sem mudar o código. No CEdev double e float têm hoje 32
+    bits; a escolha pesa no host (host/, bench/) e em toolchains com double
+    de 64 bits. Comparação de precisão e tempo: make -C bench precisao.
+
+    Autor: https://github.com/daniSoares08
+*/
+
+#ifndef REAL_H
+#define REAL_H
+
+#ifdef MECSOL_REAL_FLOAT
+#include <tgmath.h>
+typedef float real_t;
+#define REAL_NOME "float"
+#else
+#include <math.h>
+typedef double real_t;
+#define REAL_NOME "double"
+#endif
+
+#endif
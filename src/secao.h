@@ -0,0 +1,174 @@
+/*  src/secao.h
+    Tipos e API da SECAO (formato) para MECSOL - TI-84 Plus CE
+    Autor: https://github.com/daniSoares08
+*/
+
+#ifndef SECAO_H
+#define SECAO_H
+
+#include <stdbool.h>
+
+#include "real.h"
+
+/* retângulo da figura: rec=1 -> recorte (subtrai) */
+typedef struct { unsigned char rec; real_t w,h,x0,y0; } Rect;
+
+/* momentos brutos da área em relação à origem (0,0) [m^k] */
+typedef struct {
+    real_t A;              /* Int dA                          */
+    real_t Sx, Sy;         /* Int x dA, Int y dA              */
+    real_t Ixx, Iyy, Ixy;  /* Int y^2 dA, Int x^2 dA, Int xy dA */
+    real_t xmin, xmax, ymin, ymax;
+} SecMomentos;
+
+/* propriedades centroidais, montadas a partir de UMA passada de momentos */
+typedef struct {
+    real_t A;
+    real_t xbar, ybar;
+    real_t Ix, Iy, Ixy;      /* eixos centroidais paralelos a x/y        */
+    real_t I1, I2;           /* momentos principais (I1 >= I2)           */
+    real_t theta_p;          /* ângulo do eixo de I1 com o eixo x [rad]  */
+    real_t c_sup, c_inf;     /* distância do eixo x centroidal às fibras */
+    real_t S_sup, S_inf;     /* módulos elásticos Ix/c_sup e Ix/c_inf    */
+    real_t rx, ry;           /* raios de giração sqrt(I/A)              */
+    real_t xmin, xmax, ymin, ymax;
+} SecProps;
+
+/* momentos -> propriedades (eixos paralelos + Mohr), sem olhar retângulos */
+void secao_props_de_momentos(const SecMomentos *m, SecProps *p);
+
+/* inércia em torno de um eixo centroidal girado de theta [rad] a partir de x (O(1)) */
+real_t secao_I_eixo(const SecProps *p, real_t theta);
+
+/* ======== Varredura da união (uniao.c) ======== */
+#define UNIAO_MAX_RECT 16
+
+/* faixa [a,b] no eixo varrido; m0,m1,m2 = Int dt, Int t dt, Int t^2 dt
+   da parte coberta (materiais - recortes) no eixo transversal */
+typedef struct { real_t a, b, m0, m1, m2; } Faixa;
+
+/* eixo_y=0 varre em x (faixas verticais), eixo_y=1 varre em y (b(y)).
+   Devolve o número de faixas não vazias, em ordem crescente. */
+int  uniao_faixas(const Rect *r, int n, int eixo_y, Faixa *out, int max);
+
+/* momentos exatos da união (sobreposições contadas uma vez) */
+void uniao_momentos(const Rect *r, int n, SecMomentos *m);
+
+/* ======== Seção plástica (plastico.c) ======== */
+real_t plastico_area_total(void);
+bool   plastico_calcular(real_t *y_pna, real_t *Z);
+real_t plastico_Mp_N(real_t fy, real_t N, real_t *y_ln);
+int    plastico_curva(real_t fy, int n, real_t *Ns, real_t *Ms);
+
+/* ======== Cisalhamento tau = V*Q/(I*b) (cisalhamento.c) ======== */
+real_t cisalhamento_Q(real_t y, real_t *pb);
+real_t cisalhamento_tau(real_t V, real_t y);
+real_t cisalhamento_tau_max(real_t V, real_t *py);
+void   cisalhamento_perfil(real_t V, const real_t *ys, real_t *tau, int n);
+
+/* ======== Flexão oblíqua pelo fecho convexo (biaxial.c) ======== */
+
+/* extremos de sig = c1*x + c2*y; (x, y) centroidais [m], sig [N/m^2] */
+typedef struct {
+    real_t sig_max, x_max, y_max;
+    real_t sig_min, x_min, y_min;
+    real_t c1, c2;
+} Biaxial;
+
+bool biaxial_calcular(real_t Mx, real_t My, Biaxial *out);
+int  biaxial_lote(const real_t *Mx, const real_t *My, int n,
+                  real_t *sig_max, real_t *sig_min);
+int  biaxial_casco(real_t *xs, real_t *ys, int max);
+
+/* ======== Campo de tensões na viga, flexão composta (campo.c) ======== */
+
+/* M e N são os da busca de extremos (lado certo do salto quando x cai num
+   evento); não reavaliar M(x) em x. */
+typedef struct { real_t sig, x, y, M, N; } PontoCritico;   /* [N/m^2], [m], [m da base], [N*m], [N] */
+
+/* paleta 16..31: compressão (azul) -> 0 (branco) -> tração (vermelho); main.c */
+#define CAMPO_COR0   16
+#define CAMPO_NCORES 16
+
+/* flexão composta sig = N/A - M*(y - y_bar)/Ix nas fibras extremas;
+   y_ln medido da base, ln_na_secao = false se a seção toda tem o mesmo sinal */
+typedef struct {
+    real_t sig_sup, sig_inf;
+    real_t y_ln;
+    bool   ln_na_secao;
+} TensaoNM;
+
+bool campo_criticos(PontoCritico *tracao, PontoCritico *compressao);
+int  campo_grade(int nx, int ny, float *sig);
+bool campo_NM(real_t N, real_t M, TensaoNM *out);
+int  campo_NM_lote(const real_t *N, const real_t *M, int n, TensaoNM *out);
+
+/* ======== Seção importada de bitmap PBM/PGM (bitmap.c) ======== */
+typedef struct { int w, h; long pixels; } BitmapInfo;
+
+int  bitmap_listar(char nomes[][9], int max);
+bool bitmap_importar(const char *nome, real_t tam_pixel, SecMomentos *m, BitmapInfo *info);
+
+/* ======== Seção importada de desenho DXF/SVG (desenho.c) ======== */
+typedef struct { int lacos; long vertices; bool svg, fora; } DesenhoInfo;   /* fora: furo fora do contorno */
+
+int  desenho_listar(char nomes[][9], int max);
+bool desenho_importar(const char *nome, real_t escala, SecMomentos *m, DesenhoInfo *info);
+
+/* ======== Catálogo de perfis (perfis.c + perfis_tab.h gerado) ======== */
+enum { PERFIL_I, PERFIL_U, PERFIL_L, PERFIL_R };
+enum { MAT_ACO, MAT_MADEIRA };
+
+/* valores em SI; float basta para tabela (e ocupa metade no eZ80) */
+typedef struct {
+    const char *nome;
+    unsigned char tipo, mat;
+    float d, bf, tw, tf;     /* altura, mesa, alma, espessura da mesa [m] */
+    float A, Ix, Iy;         /* [m^2], [m^4], [m^4]                       */
+    float S, Z;              /* min(S_sup,S_inf) e módulo plástico [m^3]  */
+    float k_tau;             /* max Q/(Ix*b) [1/m^2]: tau_max = V*k_tau   */
+    float massa;             /* [kg/m]                                    */
+} Perfil;
+
+int  perfis_total(void);
+const Perfil *perfis_get(int i);
+const Perfil *perfis_por_S(int k);
+const Perfil *perfis_por_peso(int k);
+int  perfis_busca_nome(const char *nome);
+int  perfis_faixa_S(real_t S_min, real_t S_max, int *pk);
+int  perfis_retangulos(const Perfil *p, Rect *out);
+
+/* ======== Dimensionamento pelo catálogo (dimensionar.c) ======== */
+
+/* esforços de um membro e limites; limite <= 0 desliga a verificação */
+typedef struct {
+    real_t M, V;             /* |M|max [N*m], |V|max [N]                  */
+    real_t C_flecha;         /* |y|max * E*I [N*m^3] (viga_flecha_max_EI) */
+    real_t sig_adm, tau_adm; /* [N/m^2]                                   */
+    real_t E;                /* [N/m^2]                                   */
+    real_t flecha_adm;       /* flecha admissível [m] (ex.: L/250)        */
+    signed char mat;         /* MAT_ACO, MAT_MADEIRA ou -1 (qualquer)     */
+} Demanda;
+
+typedef struct {
+    const Perfil *p;
+    real_t util;             /* maior razão demanda/capacidade (<= 1)     */
+} Projeto;
+
+int dimensionar(const Demanda *d, Projeto *out, int max_n);
+int dimensionar_lote(const Demanda *d, int n, const Perfil **res);
+
+/* ======== API do módulo FORMATO (centroid.c) ======== */
+int    centroid_has_figure(void);
+void   centroid_get_centroid(real_t *px, real_t *py);
+real_t centroid_get_Ix(void);
+void   centroid_get_y_bounds(real_t *pymin, real_t *pymax);
+const char *centroid_get_unit_name(void);
+real_t centroid_get_unit_factor(void);
+const SecProps *centroid_get_props(void);   /* NULL se não houver figura */
+int    centroid_tem_sobreposicao(void);     /* 1 se soma simples != união */
+const Rect *centroid_get_rects(int *pn);    /* retângulos da figura (m)   */
+unsigned centroid_get_revisao(void);        /* muda a cada nova figura    */
+void   centroid_carregar_perfil(const Perfil *p);
+
+#endif
@@ -0,0 +1,138 @@
+/*  src/tela.c
+    Camada de desenho para MECSOL - TI-84 Plus CE
+    Buffer duplo + retângulos sujos (ver tela.h).
+
+    Autor: https://github.com/daniSoares08
+*/
+
+#include <graphx.h>
+#include <keypadc.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "tela.h"
+
+#define MAX_SUJOS 8
+
+typedef struct { int x, y, w, h; } Ret;
+
+static Ret     sujos[MAX_SUJOS];
+static uint8_t n_sujos = 0;
+static bool    tudo = false;     /* tela inteira mudou: troca os buffers */
+
+void tela_iniciar(void) {
+    gfx_SetDrawBuffer();
+    n_sujos = 0;
+    tudo = false;
+}
+
+void tela_limpar(void) {
+    gfx_FillScreen(0); /* branco (paleta 0) */
+    tudo = true;
+    n_sujos = 0;
+}
+
+/* a recebe a união de a e b */
+static void ret_unir(Ret *a, int x, int y, int w, int h) {
+    int x1 = a->x + a->w, y1 = a->y + a->h;
+    if (x + w > x1) x1 = x + w;
+    if (y + h > y1) y1 = y + h;
+    if (x < a->x) a->x = x;
+    if (y < a->y) a->y = y;
+    a->w = x1 - a->x;
+    a->h = y1 - a->y;
+}
+
+void tela_sujar(int x, int y, int w, int h) {
+    if (tudo) return;
+    if (x < 0) { w += x; x = 0; }
+    if (y < 0) { h += y; y = 0; }
+    if (x + w > GFX_LCD_WIDTH)  w = GFX_LCD_WIDTH - x;
+    if (y + h > GFX_LCD_HEIGHT) h = GFX_LCD_HEIGHT - y;
+    if (w <= 0 || h <= 0) return;
+
+    /* encosta ou cruza um já marcado: junta (faixas de texto vizinhas viram uma) */
+    for (int i = 0; i < n_sujos; i++) {
+        Ret *r = &sujos[i];
+        if (x <= r->x + r->w && r->x <= x + w && y <= r->y + r->h && r->y <= y + h) {
+            ret_unir(r, x, y, w, h);
+            return;
+        }
+    }
+    if (n_sujos == MAX_SUJOS) { ret_unir(&sujos[n_sujos - 1], x, y, w, h); return; }
+    sujos[n_sujos++] = (Ret){ x, y, w, h };
+}
+
+void tela_mostrar(void) {
+    if (tudo) {
+        /* quadro novo inteiro: troca no vsync e ressincroniza o buffer de
+           trás, que passa a ser o antigo visível */
+        gfx_SwapDraw();
+        gfx_BlitScreen();
+        tudo = false;
+        return;
+    }
+    for (int i = 0; i < n_sujos; i++)
+        gfx_BlitRectangle(gfx_buffer, sujos[i].x, sujos[i].y, sujos[i].w, sujos[i].h);
+    n_sujos = 0;
+}
+
+void tela_scan(void) {
+    tela_mostrar();
+    kb_Scan();
+}
+
+/* ======== TEXTO FIXO EM SPRITE ======== */
+
+#define MAX_TEXTOS   64
+#define TEXTO_ALT    8          /* fonte padrão, escala 1 */
+#define TEXTO_HEAP   12288      /* teto de heap para os sprites do cache */
+
+typedef struct { const char *s; uint8_t cor; gfx_rletsprite_t *spr; } Texto;
+
+static Texto   textos[MAX_TEXTOS];
+static uint8_t n_textos = 0;
+static size_t  textos_heap = 0;
+static uint8_t texto_tmp[2 + 255 * TEXTO_ALT];   /* gfx_sprite_t cru da captura */
+
+static void *texto_malloc(size_t n) {
+    void *p = malloc(n);
+    if (p) textos_heap += n;
+    return p;
+}
+
+void tela_texto(const char *s, int x, int y) {
+    uint8_t cor = gfx_SetTextFGColor(1);
+    gfx_SetTextFGColor(cor);
+    unsigned w = gfx_GetStringWidth(s);
+    bool cabe = w > 0 && w <= 255 && x >= 0 && y >= 0 &&
+                x + (int)w <= GFX_LCD_WIDTH && y + TEXTO_ALT <= GFX_LCD_HEIGHT;
+
+    tela_sujar(x, y, w, TEXTO_ALT);
+    if (cabe) {
+        for (int i = 0; i < n_textos; i++) {
+            if (textos[i].s == s && textos[i].cor == cor) {
+                gfx_RLETSprite_NoClip(textos[i].spr, x, y);
+                return;
+            }
+        }
+    }
+
+    /* primeira vez (ou fora do cache): glifo a glifo */
+    gfx_PrintStringXY(s, x, y);
+
+    /* pior caso do RLET: 1,5 byte por pixel + 2 por linha */
+    size_t teto = 2 + TEXTO_ALT * (3 * w / 2 + 2);
+    if (!cabe || n_textos == MAX_TEXTOS || textos_heap + teto > TEXTO_HEAP) return;
+
+    /* o fundo é branco (= transparente no RLET), então a captura é só o texto */
+    gfx_sprite_t *cru = (gfx_sprite_t *)texto_tmp;
+    cru->width = (uint8_t)w;
+    cru->height = TEXTO_ALT;
+    gfx_GetSprite(cru, x, y);
+    gfx_rletsprite_t *spr = gfx_ConvertToNewRLETSprite(cru, texto_malloc);
+    if (!spr) return;
+    textos[n_textos++] = (Texto){ s, cor, spr };
+}
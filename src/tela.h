@@ -0,0 +1,27 @@
+/*  src/tela.h
+    Camada de desenho para MECSOL - TI-84 Plus CE
+    Tudo é desenhado no buffer de trás (gfx_SetDrawBuffer); o LCD só recebe
+    o quadro pronto, então nada pisca. Quem limpa a tela (tela_limpar) suja
+    tudo; quem redesenha um pedaço marca só o retângulo (tela_sujar), e
+    tela_mostrar copia para o LCD apenas o que mudou. Moldura fixa (título,
+    rodapé, eixos) fica no buffer e não precisa ser redesenhada.
+
+    Autor: https://github.com/daniSoares08
+*/
+
+#ifndef TELA_H
+#define TELA_H
+
+void tela_iniciar(void);                        /* logo depois de gfx_Begin          */
+void tela_limpar(void);                         /* fundo branco, tela toda suja      */
+void tela_sujar(int x, int y, int w, int h);    /* região redesenhada no buffer      */
+void tela_mostrar(void);                        /* leva as regiões sujas ao LCD      */
+void tela_scan(void);                           /* tela_mostrar + kb_Scan (laços de tecla) */
+
+/* texto fixo de menus e rodapés: na primeira vez é rasterizado, guardado
+   como sprite RLET (comprimido, fundo branco transparente) e depois só
+   blitado. s precisa ser literal: a chave do cache é o endereço + cor.
+   Só para texto sobre fundo branco; se não couber, cai no PrintStringXY. */
+void tela_texto(const char *s, int x, int y);
+
+#endif
@@ -16,42 +16,42 @@
 #include <string.h>
 #include <math.h>
 
+#include "secao.h"   /* API do FORMATO (centroid.c) */
+#include "dual.h"    /* sensibilidades (derivada automática) */
+#include "tela.h"    /* buffer duplo + regiões sujas */
+#include "entrada.h"  /* editor numérico comum */
+
 #define STRBUF 64
 
 typedef struct {
-    double val;
+    real_t val;
     const char *unit;
-    double factor;
+    real_t factor;
 } DispVal;
 
 typedef struct {
-    double factor;
+    real_t factor;
     const char *name;
 } UnitOpt;
 
 typedef struct {
-    double preferred_factor;
+    real_t preferred_factor;
     bool strict_si;
 } DispConfig;
 
-/* ======== API externa que vem de centroid.c ======== */
-/* (implementadas lá no fim do arquivo) */
-
-int   centroid_has_figure(void);
-void  centroid_get_centroid(double *px, double *py);
-double centroid_get_Ix(void);
-void  centroid_get_y_bounds(double *pymin, double *pymax);
-const char *centroid_get_unit_name(void);
-double centroid_get_unit_factor(void);
-
 /* ======== API externa que vem de viga.c ======== */
 
 int    viga_has_beam(void);
-double viga_get_length(void);
+real_t viga_get_length(void);
 const char *viga_get_unit_name(void);
-double viga_get_unit_factor(void);
-double viga_momento_em(double x);
-double viga_momento_max_abs(double *px_max);
+real_t viga_get_unit_factor(void);
+real_t viga_momento_em(real_t x);
+real_t viga_momento_max_abs(real_t *px_max);
+real_t viga_cortante_em(real_t x);
+real_t viga_cortante_max_abs(real_t *px_max);
+real_t viga_flecha_max_EI(real_t *px);
+real_t viga_normal_em(real_t x);
+int    viga_tem_normal(void);
 
 /* ======== UNIDADES (escolha dinâmica mm/cm/m apenas para exibir) ======== */
 
@@ -61,17 +61,17 @@ static const UnitOpt UOPTS[] = {
     {1.0,   "m"},
 };
 
-static const UnitOpt *pick_unit(double meters, double preferred_factor, bool strict_si) {
+static const UnitOpt *pick_unit(real_t meters, real_t preferred_factor, bool strict_si) {
     if (strict_si) return &UOPTS[2];
     const UnitOpt *pref = &UOPTS[2];
     for (size_t i=0;i<3;i++) if (fabs(UOPTS[i].factor - preferred_factor) < 1e-12) pref = &UOPTS[i];
 
-    const double LOW = 0.01;
-    const double HIGH = 9999.0;
+    const real_t LOW = 0.01;
+    const real_t HIGH = 9999.0;
 
     const UnitOpt *best = pref;
-    double val = (best->factor > 0.0) ? meters / best->factor : meters;
-    double amag = fabs(val);
+    real_t val = (best->factor > 0.0) ? meters / best->factor : meters;
+    real_t amag = fabs(val);
 
     if (amag > HIGH && best->factor < 1.0) {
         if (best->factor < 0.01) best = &UOPTS[1]; else best = &UOPTS[2];
@@ -81,34 +81,34 @@ static const UnitOpt *pick_unit(double meters, double preferred_factor, bool str
     return best;
 }
 
-static DispVal disp_len(double meters, DispConfig cfg) {
+static DispVal disp_len(real_t meters, DispConfig cfg) {
     const UnitOpt *u = pick_unit(meters, cfg.preferred_factor, cfg.strict_si);
-    double v = (u->factor > 0.0) ? meters / u->factor : meters;
+    real_t v = (u->factor > 0.0) ? meters / u->factor : meters;
     return (DispVal){ v, u->name, u->factor };
 }
 
-static DispVal disp_pow(double meters_pow, DispConfig cfg, int power) {
+static DispVal disp_pow(real_t meters_pow, DispConfig cfg, int power) {
     const UnitOpt *u = pick_unit(pow(fabs(meters_pow), 1.0/power), cfg.preferred_factor, cfg.strict_si);
-    double f = u->factor;
-    double denom = 1.0;
+    real_t f = u->factor;
+    real_t denom = 1.0;
     for (int i=0;i<power;i++) denom *= f;
-    double v = (f > 0.0) ? meters_pow / denom : meters_pow;
+    real_t v = (f > 0.0) ? meters_pow / denom : meters_pow;
     return (DispVal){ v, u->name, u->factor };
 }
 
-static DispVal disp_m4(double m4, DispConfig cfg) {
+static DispVal disp_m4(real_t m4, DispConfig cfg) {
     return disp_pow(m4, cfg, 4);
 }
 
 /* converte SIG [N/m^2] para N/(unit)^2 usando o fator da unidade escolhida */
-static double sig_to_unit(double sig_N_m2, double unit_factor) {
+static real_t sig_to_unit(real_t sig_N_m2, real_t unit_factor) {
     return sig_N_m2 * unit_factor * unit_factor;
 }
 
 /* ======== TECLADO / UTIL ======== */
 
 static inline void check_on_exit(void) {
-    kb_Scan();
+    tela_scan();
     if (kb_On) {
         gfx_End();
         exit(0);
@@ -117,11 +117,7 @@ static inline void check_on_exit(void) {
 
 /* espera soltar todas as teclas (igual outros módulos) */
 static void wait_key_release(void) {
-    do {
-        kb_Scan();
-    } while (kb_Data[1] | kb_Data[2] | kb_Data[3] |
-             kb_Data[4] | kb_Data[5] | kb_Data[6] | kb_Data[7]);
-    delay(15);
+    entrada_soltar();
 }
 
 /* pressed_once: mesmo estilo do centroid.c */
@@ -129,7 +125,6 @@ static uint8_t pressed_once(kb_lkey_t lk) {
     static uint8_t prev_enter=0, prev_clear=0;
     static uint8_t prev0=0, prev1=0, prev2=0, prev3=0, prev4=0;
     static uint8_t prev5=0, prev6=0, prev7=0, prev8=0, prev9=0;
-    static uint8_t prevDot=0, prevNeg=0;
     uint8_t *prev=NULL;
     switch(lk) {
         case kb_KeyEnter:  prev=&prev_enter; break;
@@ -144,8 +139,6 @@ static uint8_t pressed_once(kb_lkey_t lk) {
         case kb_Key7:      prev=&prev7; break;
         case kb_Key8:      prev=&prev8; break;
         case kb_Key9:      prev=&prev9; break;
-        case kb_KeyDecPnt: prev=&prevDot; break;
-        case kb_KeyChs:    prev=&prevNeg; break;
         default: return 0;
     }
     uint8_t down = kb_IsDown(lk) ? 1 : 0;
@@ -159,66 +152,24 @@ static void wait_enter_or_clear_tens(void) {
     wait_key_release();
     while (1) {
         check_on_exit();
-        kb_Scan();
+        tela_scan();
         if (pressed_once(kb_KeyEnter)) return;
         if (pressed_once(kb_KeyClear)) return;
-        delay(10);
+        entrada_dormir();
     }
 }
 
 /* ======== INPUT NUMÉRICO (estilo centroid.c) ======== */
 
 static void input_line(char *buf, int maxlen, const char *prompt){
-    int idx=0;
-    bool dirty = true;
-    buf[0]='\0';
-
-    gfx_FillScreen(0);
+    tela_limpar();
     gfx_SetTextFGColor(1);
     gfx_PrintStringXY(prompt, 2, 2);
     gfx_PrintStringXY("ENTER=ok CLEAR=apaga ON=sair", 2, 78);
-
-    for(;;){
-        check_on_exit();
-        kb_Scan();
-
-        if (dirty) {
-            gfx_SetColor(0);
-            gfx_FillRectangle(0, 18, 320, 12);
-            gfx_SetTextFGColor(1);
-            gfx_PrintStringXY(buf, 2, 18);
-            dirty = false;
-        }
-
-        if (pressed_once(kb_KeyEnter)) {
-            buf[idx]='\0';
-            return;
-        }
-        if (pressed_once(kb_KeyClear)) {
-            if (idx>0){
-                idx--;
-                buf[idx]='\0';
-                dirty = true;
-            }
-        }
-        if (pressed_once(kb_Key0) && idx<maxlen-1){ buf[idx++]='0'; buf[idx]='\0'; dirty = true; }
-        if (pressed_once(kb_Key1) && idx<maxlen-1){ buf[idx++]='1'; buf[idx]='\0'; dirty = true; }
-        if (pressed_once(kb_Key2) && idx<maxlen-1){ buf[idx++]='2'; buf[idx]='\0'; dirty = true; }
-        if (pressed_once(kb_Key3) && idx<maxlen-1){ buf[idx++]='3'; buf[idx]='\0'; dirty = true; }
-        if (pressed_once(kb_Key4) && idx<maxlen-1){ buf[idx++]='4'; buf[idx]='\0'; dirty = true; }
-        if (pressed_once(kb_Key5) && idx<maxlen-1){ buf[idx++]='5'; buf[idx]='\0'; dirty = true; }
-        if (pressed_once(kb_Key6) && idx<maxlen-1){ buf[idx++]='6'; buf[idx]='\0'; dirty = true; }
-        if (pressed_once(kb_Key7) && idx<maxlen-1){ buf[idx++]='7'; buf[idx]='\0'; dirty = true; }
-        if (pressed_once(kb_Key8) && idx<maxlen-1){ buf[idx++]='8'; buf[idx]='\0'; dirty = true; }
-        if (pressed_once(kb_Key9) && idx<maxlen-1){ buf[idx++]='9'; buf[idx]='\0'; dirty = true; }
-        if (pressed_once(kb_KeyDecPnt) && idx<maxlen-1){ buf[idx++]='.'; buf[idx]='\0'; dirty = true; }
-        if (pressed_once(kb_KeyChs)    && idx<maxlen-1){ buf[idx++]='-'; buf[idx]='\0'; dirty = true; }
-
-        delay(10);
-    }
+    entrada_linha(buf, maxlen, 2, 18, 316);
 }
 
-static double input_double(const char *prompt){
+static real_t input_double(const char *prompt){
     char s[STRBUF];
     input_line(s, STRBUF, prompt);
     for (int i=0; s[i]; ++i) if (s[i] == ',') s[i] = '.';
@@ -227,11 +178,11 @@ static double input_double(const char *prompt){
 
 /* ======== CONVERSÕES DE UNIDADE ======== */
 
-static DispConfig selecionar_unidade_resposta(double base_factor, const char *base_unit) {
+static DispConfig selecionar_unidade_resposta(real_t base_factor, const char *base_unit) {
     DispConfig cfg = { base_factor, false };
     (void)base_unit;
 
-    gfx_FillScreen(0);
+    tela_limpar();
     gfx_SetTextFGColor(1);
     gfx_PrintStringXY("Unidade das respostas:", 2, 2);
     gfx_PrintStringXY("1) Auto (usa a unidade do formato)", 2, 18);
@@ -242,13 +193,13 @@ static DispConfig selecionar_unidade_resposta(double base_factor, const char *ba
 
     while (1) {
         check_on_exit();
-        kb_Scan();
+        tela_scan();
         if (pressed_once(kb_Key1)) { cfg.preferred_factor = base_factor; cfg.strict_si = false; break; }
         if (pressed_once(kb_Key2)) { cfg.preferred_factor = 0.001; cfg.strict_si = false; break; }
         if (pressed_once(kb_Key3)) { cfg.preferred_factor = 0.01;  cfg.strict_si = false; break; }
         if (pressed_once(kb_Key4) || pressed_once(kb_KeyEnter)) { cfg.preferred_factor = 1.0; cfg.strict_si = true; break; }
         if (pressed_once(kb_KeyClear)) { break; }
-        delay(10);
+        entrada_dormir();
     }
 
     /* Se a unidade base nao eh "m" e usuario pediu S.I., usa forcar metro */
@@ -263,11 +214,11 @@ static DispConfig selecionar_unidade_resposta(double base_factor, const char *ba
 /* ======== TELAS DAS 3 ETAPAS ======== */
 
 /* etapa 1: centroide */
-static void draw_page_centroid(double xbar, double ybar,
+static void draw_page_centroid(real_t xbar, real_t ybar,
                                const char *unit_name,
                                DispConfig disp_cfg) {
     (void)unit_name; /* unidade real exibida ajustada dinamicamente */
-    gfx_FillScreen(0);
+    tela_limpar();
     gfx_SetTextFGColor(1);
 
     gfx_PrintStringXY("ETAPA 1 - CENTROIDE DA SECAO", 2, 2);
@@ -288,12 +239,12 @@ static void draw_page_centroid(double xbar, double ybar,
 }
 
 /* etapa 2: Ix + distancias extremas ao eixo neutro */
-static void draw_page_inercia(double Ix,
-                              double y_sup, double y_inf,
+static void draw_page_inercia(real_t Ix,
+                              real_t y_sup, real_t y_inf,
                               const char *unit_name,
                               DispConfig disp_cfg) {
     (void)unit_name;
-    gfx_FillScreen(0);
+    tela_limpar();
     gfx_SetTextFGColor(1);
 
     gfx_PrintStringXY("ETAPA 2 - INERCIA Ix", 2, 2);
@@ -318,14 +269,14 @@ static void draw_page_inercia(double Ix,
 }
 
 /* origem: 0=manual sem viga, 1=viga ponto x, 2=viga Mmax, 3=viga simples P em L */
-static void draw_page_tensoes(double M, double x_pos, int origem,
-                              double xbar, double ybar,
-                              double ymin, double ymax,
-                              double Ix,
+static void draw_page_tensoes(real_t M, real_t x_pos, int origem,
+                              real_t xbar, real_t ybar,
+                              real_t ymin, real_t ymax,
+                              real_t Ix,
                               const char *unit_name,
                               DispConfig disp_cfg) {
     (void)unit_name;
-    gfx_FillScreen(0);
+    tela_limpar();
     gfx_SetTextFGColor(1);
 
     gfx_PrintStringXY("ETAPA 3 - TENSOES POR FLEXAO", 2, 2);
@@ -353,15 +304,15 @@ static void draw_page_tensoes(double M, double x_pos, int origem,
     gfx_PrintStringXY("SIG = - M * y / Ix", 2, 62);
 
     /* y relativos ao eixo neutro (y>0 para cima) */
-    double dy_sup = ymax - ybar;   /* >0 */
-    double dy_inf = ymin - ybar;   /* <0 (fibra inferior) */
+    real_t dy_sup = ymax - ybar;   /* >0 */
+    real_t dy_inf = ymin - ybar;   /* <0 (fibra inferior) */
 
-    double y_sup_abs = fabs(dy_sup);
-    double y_inf_abs = fabs(dy_inf);
+    real_t y_sup_abs = fabs(dy_sup);
+    real_t y_inf_abs = fabs(dy_inf);
 
     DispVal dy_disp = disp_len(y_sup_abs, disp_cfg); /* usa mesma unidade para sup/inf */
-    double y_sup_show = dy_disp.val;
-    double y_inf_show = dy_inf < 0 ? -(y_inf_abs / dy_disp.factor)
+    real_t y_sup_show = dy_disp.val;
+    real_t y_inf_show = dy_inf < 0 ? -(y_inf_abs / dy_disp.factor)
                                    :  (y_inf_abs / dy_disp.factor);
 
     sprintf(buf, "y_sup = +%.3f %s", y_sup_show, dy_disp.unit);
@@ -375,12 +326,12 @@ static void draw_page_tensoes(double M, double x_pos, int origem,
     }
 
     /* SIG no topo e na base (em N/m^2) */
-    double sig_sup = -M * dy_sup / Ix;
-    double sig_inf = -M * dy_inf / Ix;
+    real_t sig_sup = -M * dy_sup / Ix;
+    real_t sig_inf = -M * dy_inf / Ix;
 
     /* converte para N/(unidade)^2 */
-    double sig_sup_u = sig_to_unit(sig_sup, dy_disp.factor);
-    double sig_inf_u = sig_to_unit(sig_inf, dy_disp.factor);
+    real_t sig_sup_u = sig_to_unit(sig_sup, dy_disp.factor);
+    real_t sig_inf_u = sig_to_unit(sig_inf, dy_disp.factor);
 
     sprintf(buf, "SIG_sup = %.3f N/%s^2", sig_sup_u, dy_disp.unit);
     gfx_PrintStringXY(buf, 2, 118);
@@ -388,7 +339,7 @@ static void draw_page_tensoes(double M, double x_pos, int origem,
     gfx_PrintStringXY(buf, 2, 130);
 
     /* máximas de tracao (>0) e compressao (<0) */
-    double sig_trac = 0.0, sig_comp = 0.0;
+    real_t sig_trac = 0.0, sig_comp = 0.0;
 
     if (sig_sup_u >= 0.0 && sig_inf_u <= 0.0) {
         sig_trac = sig_sup_u;
@@ -417,24 +368,24 @@ static void draw_page_tensoes(double M, double x_pos, int origem,
 /* ======== MOSTRAR AS 3 ETAPAS COM NAVEGACAO ======== */
 /* origem: 0=manual, 1=ponto viga, 2=Mmax viga, 3=viga simples P em L */
 
-static void mostrar_etapas(double M, double x_pos, int origem) {
+static void mostrar_etapas(real_t M, real_t x_pos, int origem) {
     if (!centroid_has_figure()) return;
 
-    double xbar, ybar;
+    real_t xbar, ybar;
     centroid_get_centroid(&xbar, &ybar);
 
-    double ymin, ymax;
+    real_t ymin, ymax;
     centroid_get_y_bounds(&ymin, &ymax);
 
-    double Ix = centroid_get_Ix();
+    real_t Ix = centroid_get_Ix();
     const char *unit_name = centroid_get_unit_name();
-    double unit_factor = centroid_get_unit_factor();
+    real_t unit_factor = centroid_get_unit_factor();
 
     DispConfig disp_cfg = selecionar_unidade_resposta(unit_factor, unit_name);
 
     /* distancias extremas positivas (usadas na tela 2) */
-    double y_sup = fabs(ymax - ybar);
-    double y_inf = fabs(ybar - ymin);
+    real_t y_sup = fabs(ymax - ybar);
+    real_t y_inf = fabs(ybar - ymin);
 
     int page = 0;
     const int PAGE_MAX = 2; /* 0: centroide, 1: Ix, 2: SIG */
@@ -454,13 +405,13 @@ static void mostrar_etapas(double M, double x_pos, int origem) {
 
         gfx_SetTextFGColor(1);
         if (page < PAGE_MAX)
-            gfx_PrintStringXY("LEFT/RIGHT: paginas  ENTER: prox  CLEAR: sair", 2, 220);
+            tela_texto("LEFT/RIGHT: paginas  ENTER: prox  CLEAR: sair", 2, 220);
         else
-            gfx_PrintStringXY("LEFT/RIGHT: paginas  ENTER/CLEAR: sair", 2, 220);
+            tela_texto("LEFT/RIGHT: paginas  ENTER/CLEAR: sair", 2, 220);
 
         while (1) {
             check_on_exit();
-            kb_Scan();
+            tela_scan();
             if (pressed_once(kb_KeyLeft)) {
                 if (page > 0) page--;
                 break;
@@ -479,7 +430,488 @@ static void mostrar_etapas(double M, double x_pos, int origem) {
             if (pressed_once(kb_KeyClear)) {
                 return;
             }
-            delay(10);
+            entrada_dormir();
+        }
+    }
+}
+
+/* ======== CISALHAMENTO (tau = V*Q/(Ix*b)) ======== */
+/* origem: 0=V informado, 1=Vmax da viga */
+
+/* seção importada (bitmap/desenho) só guarda os momentos: sem retângulos
+   não há Q(y), b(y), fecho convexo nem b_i/h_i para derivar */
+static bool secao_sem_retangulos(int y) {
+    int n = 0;
+    centroid_get_rects(&n);
+    if (n > 0) return false;
+    gfx_PrintStringXY("Indisponivel para secao importada", 2, y);
+    gfx_PrintStringXY("(bitmap/desenho: sem retangulos).", 2, y + 12);
+    return true;
+}
+
+static void mostrar_cisalhamento(real_t V, real_t x_pos, int origem) {
+    if (!centroid_has_figure()) return;
+
+    const SecProps *p = centroid_get_props();
+    DispConfig disp_cfg = selecionar_unidade_resposta(centroid_get_unit_factor(),
+                                                      centroid_get_unit_name());
+    wait_key_release();
+
+    tela_limpar();
+    gfx_SetTextFGColor(1);
+    gfx_PrintStringXY("CISALHAMENTO - TAU = V*Q/(Ix*b)", 2, 2);
+    gfx_PrintStringXY("ENTER/CLEAR: voltar", 2, 220);
+
+    char buf[STRBUF];
+    if (origem == 0) {
+        gfx_PrintStringXY("Caso: cortante informado (sem viga)", 2, 18);
+    } else {
+        DispVal dx = disp_len(x_pos, disp_cfg);
+        sprintf(buf, "Caso: Vmax da viga em x=%.3f %s", dx.val, dx.unit);
+        gfx_PrintStringXY(buf, 2, 18);
+    }
+    sprintf(buf, "V = %.3f N (%.3f kN)", V, V/1000.0);
+    gfx_PrintStringXY(buf, 2, 30);
+
+    if (!p || p->Ix <= 0.0) {
+        gfx_PrintStringXY("Ix = 0 -> nao e possivel obter TAU.", 2, 50);
+        return;
+    }
+    if (secao_sem_retangulos(50)) return;
+
+    real_t y_tmax;
+    real_t tmax = cisalhamento_tau_max(V, &y_tmax);
+    real_t b;
+    real_t Q = cisalhamento_Q(y_tmax, &b);
+
+    DispVal dy = disp_len(y_tmax, disp_cfg);
+    DispVal db = disp_len(b, disp_cfg);
+    DispVal dQ = disp_pow(Q, disp_cfg, 3);
+    sprintf(buf, "y(TAU max) = %.3f %s (da base)", dy.val, dy.unit);
+    gfx_PrintStringXY(buf, 2, 46);
+    sprintf(buf, "Q = %.3f %s^3   b = %.3f %s", dQ.val, dQ.unit, db.val, db.unit);
+    gfx_PrintStringXY(buf, 2, 58);
+    sprintf(buf, "TAU_max = %.3f N/%s^2", sig_to_unit(tmax, dy.factor), dy.unit);
+    gfx_PrintStringXY(buf, 2, 70);
+    real_t tLN = fabs(cisalhamento_tau(V, p->ybar));
+    sprintf(buf, "TAU(y_bar) = %.3f N/%s^2", sig_to_unit(tLN, dy.factor), dy.unit);
+    gfx_PrintStringXY(buf, 2, 82);
+
+    /* perfil tau(y) ao longo da altura (consulta densa) */
+    enum { NPT = 64 };
+    real_t ys[NPT], tau[NPT];
+    const int gx0 = 60, gx1 = 300, gy0 = 100, gy1 = 208;
+    real_t h = p->ymax - p->ymin;
+    for (int i = 0; i < NPT; i++) ys[i] = p->ymin + h * (real_t)i / (real_t)(NPT - 1);
+    cisalhamento_perfil(fabs(V), ys, tau, NPT);
+
+    gfx_SetColor(1);
+    gfx_VertLine(gx0, gy0, gy1 - gy0);
+    gfx_PrintStringXY("y", gx0 - 12, gy0);
+    gfx_PrintStringXY("TAU(y)", gx1 - 48, gy1 - 10);
+    if (tmax > 0.0) {
+        gfx_SetColor(2);
+        int lx = 0, ly = 0;
+        for (int i = 0; i < NPT; i++) {
+            int px = gx0 + (int)(tau[i] / tmax * (gx1 - gx0));
+            int py = gy1 - (int)((real_t)i / (NPT - 1) * (gy1 - gy0));
+            if (i > 0) gfx_Line(lx, ly, px, py);
+            lx = px; ly = py;
+        }
+        gfx_SetColor(1);
+    }
+}
+
+/* ======== DIMENSIONAMENTO (catálogo de perfis) ======== */
+
+/* pede limites, busca os perfis mais leves que passam e deixa carregar um */
+static void mostrar_dimensionamento(void) {
+    enum { TOPN = 5 };
+    Demanda d;
+    Projeto res[TOPN];
+    char buf[STRBUF];
+
+    d.M = viga_momento_max_abs(NULL);
+    d.V = viga_cortante_max_abs(NULL);
+    d.C_flecha = viga_flecha_max_EI(NULL);
+
+    d.sig_adm = input_double("SIG admissivel (MPa):") * 1e6;
+    d.tau_adm = input_double("TAU admissivel (MPa, 0=ignora):") * 1e6;
+    d.E       = input_double("E (GPa, 0=ignora flecha):") * 1e9;
+    real_t lim = 0.0;
+    if (d.E > 0.0) lim = input_double("Flecha max = L/? (ex: 250):");
+    d.flecha_adm = (lim > 0.0) ? viga_get_length() / lim : 0.0;
+    int m = (int)input_double("Material: 1 aco 2 madeira 0 todos");
+    d.mat = (m == 1) ? MAT_ACO : (m == 2) ? MAT_MADEIRA : -1;
+
+    int n = dimensionar(&d, res, TOPN);
+    wait_key_release();
+
+    tela_limpar();
+    gfx_SetTextFGColor(1);
+    gfx_PrintStringXY("DIMENSIONAR - mais leves que passam", 2, 2);
+    sprintf(buf, "|M|=%.3f kN*m  |V|=%.3f kN", d.M/1000.0, d.V/1000.0);
+    gfx_PrintStringXY(buf, 2, 16);
+    if (d.sig_adm > 0.0) {
+        sprintf(buf, "S_req = M/SIG = %.1f cm^3", fabs(d.M)/d.sig_adm*1e6);
+        gfx_PrintStringXY(buf, 2, 28);
+    }
+
+    if (n == 0) {
+        gfx_PrintStringXY("Nenhum perfil do catalogo passa.", 2, 50);
+        gfx_PrintStringXY("ENTER/CLEAR: voltar", 2, 220);
+        wait_enter_or_clear_tens();
+        return;
+    }
+    for (int i = 0; i < n; i++) {
+        sprintf(buf, "%d) %-12s %6.1f kg/m  %3d%%", i + 1, res[i].p->nome,
+                (real_t)res[i].p->massa, (int)(res[i].util * 100.0 + 0.5));
+        gfx_PrintStringXY(buf, 2, 48 + 12*i);
+    }
+    gfx_PrintStringXY("% = maior razao (flexao/cisalh./flecha)", 2, 118);
+    gfx_PrintStringXY("1..N carrega no Formato, CLEAR volta", 2, 220);
+
+    wait_key_release();
+    while (1) {
+        check_on_exit();
+        tela_scan();
+        int k = 0;
+        if      (pressed_once(kb_Key1) || pressed_once(kb_KeyEnter)) k = 1;
+        else if (pressed_once(kb_Key2)) k = 2;
+        else if (pressed_once(kb_Key3)) k = 3;
+        else if (pressed_once(kb_Key4)) k = 4;
+        else if (pressed_once(kb_Key5)) k = 5;
+        else if (pressed_once(kb_KeyClear)) { wait_key_release(); return; }
+        if (k >= 1 && k <= n) {
+            centroid_carregar_perfil(res[k-1].p);
+            gfx_SetColor(0);
+            gfx_FillRectangle(0, 208, 320, 24);
+            sprintf(buf, "%s carregado. ENTER/CLEAR", res[k-1].p->nome);
+            gfx_PrintStringXY(buf, 2, 220);
+            tela_sujar(0, 208, 320, 24);
+            wait_enter_or_clear_tens();
+            return;
+        }
+        entrada_dormir();
+    }
+}
+
+/* ======== SENSIBILIDADES (números duais) ======== */
+
+/* d(sig)/d(b_i, h_i, P_j, a_j) na estação de |M| máximo, numa passada só:
+   a seção leva b_i/h_i semeados, a viga leva P_j/a_j, e a fórmula
+   sig = -M*y/Ix junta tudo. */
+static void mostrar_sensibilidades(void) {
+    char buf[STRBUF];
+    int n = 0;
+    centroid_get_rects(&n);
+    int nP = viga_n_cargas_p();
+
+    int i = 1, j = 1;
+    if (n > 1) {
+        sprintf(buf, "Retangulo (1..%d):", n);
+        i = (int)input_double(buf);
+    }
+    if (nP > 1) {
+        sprintf(buf, "Carga pontual (1..%d):", nP);
+        j = (int)input_double(buf);
+    }
+    if (i < 1 || i > n) i = 1;
+    if (j < 1 || j > nP) j = 1;
+
+    /* a estação de |M| máximo pode ser um evento (engaste, carga):
+       fica o lado do salto com o maior |M| */
+    real_t xM = 0.0;
+    viga_momento_max_abs(&xM);
+    SecDual sd;
+    Dual M, Md;
+    int jj = nP > 0 ? j - 1 : -1;
+    bool ok_sec = centroid_props_dual(i - 1, DS_B, DS_H, &sd);
+    bool ok_vig = viga_momento_dual(xM, -1, jj, DS_P, DS_A, &M);
+    if (ok_vig && viga_momento_dual(xM, +1, jj, DS_P, DS_A, &Md) && fabs(Md.v) > fabs(M.v)) M = Md;
+    wait_key_release();
+
+    tela_limpar();
+    gfx_SetTextFGColor(1);
+    gfx_PrintStringXY("SENSIBILIDADES (derivada exata)", 2, 2);
+    gfx_PrintStringXY("ENTER/CLEAR: voltar", 2, 220);
+    if (secao_sem_retangulos(24)) {
+        wait_enter_or_clear_tens();
+        return;
+    }
+    if (!ok_sec || !ok_vig || sd.Ix.v <= 0.0) {
+        gfx_PrintStringXY("Sem derivadas: figura com", 2, 24);
+        gfx_PrintStringXY(ok_sec ? "Ix nulo ou viga invalida."
+                                 : "sobreposicao ou area nula.", 2, 36);
+        wait_enter_or_clear_tens();
+        return;
+    }
+
+    /* sig = -M*y/Ix nas fibras extremas (y medido do centroide) */
+    Dual sig_sup = dual_esc(dual_div(dual_mul(M, sd.c_sup), sd.Ix), -1.0);
+    Dual sig_inf = dual_div(dual_mul(M, sd.c_inf), sd.Ix);
+
+    sprintf(buf, "x=%.3f m  M=%.3f kN*m", xM, M.v/1000.0);
+    gfx_PrintStringXY(buf, 2, 16);
+    sprintf(buf, "Ret %d (b,h)   Carga %d (P,a)", i, nP > 0 ? j : 0);
+    gfx_PrintStringXY(buf, 2, 28);
+
+    sprintf(buf, "dIx/db = %.4g cm^4/mm", sd.Ix.d[DS_B] * 1e8 * 1e-3);
+    gfx_PrintStringXY(buf, 2, 46);
+    sprintf(buf, "dIx/dh = %.4g cm^4/mm", sd.Ix.d[DS_H] * 1e8 * 1e-3);
+    gfx_PrintStringXY(buf, 2, 58);
+    if (nP > 0) {
+        sprintf(buf, "dMmax/dP = %.4g kN*m/kN", M.d[DS_P]);
+        gfx_PrintStringXY(buf, 2, 74);
+        sprintf(buf, "dMmax/da = %.4g kN*m/m", M.d[DS_A] / 1000.0);
+        gfx_PrintStringXY(buf, 2, 86);
+    }
+
+    const Dual *sg[2] = { &sig_sup, &sig_inf };
+    const char *nome[2] = { "sup", "inf" };
+    for (int k = 0; k < 2; k++) {
+        int y = 104 + 52*k;
+        sprintf(buf, "SIG_%s = %.3f MPa", nome[k], sg[k]->v / 1e6);
+        gfx_PrintStringXY(buf, 2, y);
+        sprintf(buf, " d/db=%.3g d/dh=%.3g MPa/mm",
+                sg[k]->d[DS_B] * 1e-9, sg[k]->d[DS_H] * 1e-9);
+        gfx_PrintStringXY(buf, 2, y + 12);
+        if (nP > 0) {
+            sprintf(buf, " d/dP=%.3g MPa/kN d/da=%.3g MPa/m",
+                    sg[k]->d[DS_P] * 1e-3, sg[k]->d[DS_A] * 1e-6);
+            gfx_PrintStringXY(buf, 2, y + 24);
+        }
+    }
+    wait_enter_or_clear_tens();
+}
+
+/* ======== FLEXÃO OBLÍQUA (Mx, My) ======== */
+
+/* fibras extremas pelo fecho convexo da seção (biaxial.c) + desenho do fecho */
+static void mostrar_biaxial(real_t Mx, real_t My) {
+    enum { HMAX = 32 };
+    real_t xs[HMAX], ys[HMAX];
+    char buf[STRBUF];
+    DispConfig cfg = { centroid_get_unit_factor(), false };
+    Biaxial b;
+
+    tela_limpar();
+    gfx_SetTextFGColor(1);
+    gfx_PrintStringXY("FLEXAO OBLIQUA - fibras extremas", 2, 2);
+    gfx_PrintStringXY("ENTER/CLEAR: voltar", 2, 220);
+    if (secao_sem_retangulos(24)) {
+        wait_enter_or_clear_tens();
+        return;
+    }
+
+    int h = biaxial_casco(xs, ys, HMAX);
+    if (h < 3 || !biaxial_calcular(Mx, My, &b)) {
+        gfx_PrintStringXY("Secao sem area/inercia valida.", 2, 24);
+        wait_enter_or_clear_tens();
+        return;
+    }
+
+    sprintf(buf, "Mx=%.3f  My=%.3f N*m", Mx, My);
+    gfx_PrintStringXY(buf, 2, 16);
+    DispVal ax = disp_len(b.x_max, cfg);
+    sprintf(buf, "SIG max=%.3f MPa (%.2f,%.2f %s)", b.sig_max/1e6, ax.val, b.y_max / ax.factor, ax.unit);
+    gfx_PrintStringXY(buf, 2, 30);
+    DispVal bx = disp_len(b.x_min, cfg);
+    sprintf(buf, "SIG min=%.3f MPa (%.2f,%.2f %s)", b.sig_min/1e6, bx.val, b.y_min / bx.factor, bx.unit);
+    gfx_PrintStringXY(buf, 2, 42);
+    gfx_PrintStringXY("(x,y) a partir do centroide", 2, 54);
+
+    /* fecho em escala dentro da caixa 60..260 x 70..210 */
+    real_t xmn = xs[0], xmx = xs[0], ymn = ys[0], ymx = ys[0];
+    for (int k = 1; k < h; k++) {
+        if (xs[k] < xmn) xmn = xs[k];
+        if (xs[k] > xmx) xmx = xs[k];
+        if (ys[k] < ymn) ymn = ys[k];
+        if (ys[k] > ymx) ymx = ys[k];
+    }
+    real_t esc_x = 200.0 / (xmx - xmn), esc_y = 136.0 / (ymx - ymn);
+    real_t esc = (esc_x < esc_y) ? esc_x : esc_y;
+    int cx = 160 - (int)(0.5 * (xmn + xmx) * esc);
+    int cy = 140 + (int)(0.5 * (ymn + ymx) * esc);
+
+    gfx_SetColor(1);
+    for (int k = 0; k < h; k++) {
+        int k1 = (k + 1) % h;
+        gfx_Line(cx + (int)(xs[k] * esc), cy - (int)(ys[k] * esc),
+                 cx + (int)(xs[k1] * esc), cy - (int)(ys[k1] * esc));
+    }
+    gfx_FillCircle(cx, cy, 1);   /* centroide */
+    gfx_SetColor(2);
+    gfx_FillCircle(cx + (int)(b.x_max * esc), cy - (int)(b.y_max * esc), 3);
+    gfx_Circle(cx + (int)(b.x_min * esc), cy - (int)(b.y_min * esc), 3);
+    gfx_SetColor(1);
+    wait_enter_or_clear_tens();
+}
+
+/* ======== FLEXÃO COMPOSTA (N + M) ======== */
+
+/* sig = N/A - M*y/Ix: a linha neutra sai do centroide e pode sair da seção */
+static void mostrar_NM(real_t N, real_t M, real_t x_pos, int origem) {
+    const SecProps *p = centroid_get_props();
+    DispConfig cfg = { centroid_get_unit_factor(), false };
+    TensaoNM r;
+    char buf[STRBUF];
+
+    tela_limpar();
+    gfx_SetTextFGColor(1);
+    gfx_PrintStringXY("FLEXAO COMPOSTA: SIG = N/A - M*y/Ix", 2, 2);
+    gfx_PrintStringXY("ENTER/CLEAR: voltar", 2, 220);
+    if (!p || !campo_NM(N, M, &r)) {
+        gfx_PrintStringXY("A ou Ix = 0 -> sem tensao.", 2, 24);
+        wait_enter_or_clear_tens();
+        return;
+    }
+
+    if (origem == 0) sprintf(buf, "N=%.3f N  M=%.3f N*m", N, M);
+    else             sprintf(buf, "x=%.3f m: N=%.3f N  M=%.3f N*m", x_pos, N, M);
+    gfx_PrintStringXY(buf, 2, 16);
+    DispVal dA = disp_pow(p->A, cfg, 2);
+    sprintf(buf, "A=%.3f %s^2   N/A=%.3f MPa", dA.val, dA.unit, N / p->A / 1e6);
+    gfx_PrintStringXY(buf, 2, 30);
+    sprintf(buf, "SIG_sup = %.3f MPa", r.sig_sup / 1e6);
+    gfx_PrintStringXY(buf, 2, 44);
+    sprintf(buf, "SIG_inf = %.3f MPa", r.sig_inf / 1e6);
+    gfx_PrintStringXY(buf, 2, 56);
+    if (r.ln_na_secao) {
+        DispVal dy = disp_len(r.y_ln, cfg);
+        DispVal dd = disp_len(r.y_ln - p->ybar, cfg);
+        sprintf(buf, "LN: y=%.3f %s (da base)", dy.val, dy.unit);
+        gfx_PrintStringXY(buf, 2, 70);
+        sprintf(buf, "    desloc. %.3f %s do centroide", dd.val, dd.unit);
+        gfx_PrintStringXY(buf, 2, 82);
+    } else {
+        gfx_PrintStringXY(r.sig_sup + r.sig_inf >= 0.0 ? "LN fora: secao toda tracionada"
+                                                       : "LN fora: secao toda comprimida", 2, 70);
+    }
+
+    /* diagrama sig(y): base embaixo, topo em cima, eixo sig = 0 no meio */
+    const int gx = 160, gy0 = 100, gy1 = 208, gw = 120;
+    real_t smax = fabs(r.sig_sup) > fabs(r.sig_inf) ? fabs(r.sig_sup) : fabs(r.sig_inf);
+    gfx_SetColor(1);
+    gfx_VertLine(gx, gy0, gy1 - gy0);
+    gfx_PrintStringXY("topo", gx - 40, gy0);
+    gfx_PrintStringXY("base", gx - 40, gy1 - 8);
+    if (smax > 0.0) {
+        int xs = gx + (int)(r.sig_sup / smax * gw);
+        int xi = gx + (int)(r.sig_inf / smax * gw);
+        gfx_SetColor(2);
+        gfx_Line(gx, gy0, xs, gy0);
+        gfx_Line(gx, gy1, xi, gy1);
+        gfx_Line(xs, gy0, xi, gy1);
+        if (r.ln_na_secao) {
+            int yl = gy1 - (int)((r.y_ln - p->ymin) / (p->ymax - p->ymin) * (gy1 - gy0));
+            gfx_HorizLine(gx - 30, yl, 60);
+            gfx_PrintStringXY("LN", gx + 34, yl - 4);
+        }
+        gfx_SetColor(1);
+    }
+    wait_enter_or_clear_tens();
+}
+
+/* ======== CAMPO SIG(x,y) E PONTOS CRÍTICOS ======== */
+
+/* grade colorida sig(x,y): x ao longo da viga, y na altura da seção */
+static void mostrar_campo(void) {
+    enum { NX = 64, NY = 32, CX = 4, CY = 4, X0 = 32, Y0 = 40 };
+    static float grade[NX * NY];
+    char buf[STRBUF];
+
+    tela_limpar();
+    gfx_SetTextFGColor(1);
+    gfx_PrintStringXY("CAMPO SIG(x,y) = N/A - M*y/Ix", 2, 2);
+    gfx_PrintStringXY("ENTER/CLEAR: voltar", 2, 220);
+
+    if (campo_grade(NX, NY, grade) != NX * NY) {
+        gfx_PrintStringXY("Nao foi possivel montar a grade.", 2, 24);
+        wait_enter_or_clear_tens();
+        return;
+    }
+    float smax = 0.0f;
+    for (int k = 0; k < NX * NY; k++) {
+        float a = grade[k] < 0.0f ? -grade[k] : grade[k];
+        if (a > smax) smax = a;
+    }
+
+    for (int j = 0; j < NY; j++) {
+        int py = Y0 + (NY - 1 - j) * CY;      /* j = 0 na base -> embaixo */
+        for (int i = 0; i < NX; i++) {
+            float t = (smax > 0.0f) ? grade[j * NX + i] / smax : 0.0f;
+            int c = (int)((t + 1.0f) * 0.5f * (CAMPO_NCORES - 1) + 0.5f);
+            gfx_SetColor(CAMPO_COR0 + c);
+            gfx_FillRectangle(X0 + i * CX, py, CX, CY);
+        }
+    }
+    gfx_SetColor(1);
+    gfx_Rectangle(X0 - 1, Y0 - 1, NX * CX + 2, NY * CY + 2);
+
+    gfx_PrintStringXY("0", X0 - 4, Y0 + NY * CY + 4);
+    gfx_PrintStringXY("L", X0 + NX * CX - 4, Y0 + NY * CY + 4);
+    gfx_PrintStringXY("topo", 0, Y0);
+    gfx_PrintStringXY("base", 0, Y0 + NY * CY - 8);
+    sprintf(buf, "|SIG| max = %.3f MPa", smax / 1e6);
+    gfx_PrintStringXY(buf, 2, 16);
+    gfx_PrintStringXY("azul = compressao  vermelho = tracao", 2, 196);
+    wait_enter_or_clear_tens();
+}
+
+/* tração e compressão governantes na viga toda (M+ e M- contra as duas fibras) */
+static void mostrar_criticos(void) {
+    PontoCritico t, c;
+    char buf[STRBUF];
+
+    while (1) {
+        tela_limpar();
+        gfx_SetTextFGColor(1);
+        gfx_PrintStringXY("SIG MAX NA VIGA (exato)", 2, 2);
+        if (!campo_criticos(&t, &c)) {
+            gfx_PrintStringXY("Viga ou secao invalida.", 2, 24);
+            gfx_PrintStringXY("ENTER/CLEAR: voltar", 2, 220);
+            wait_enter_or_clear_tens();
+            return;
+        }
+        real_t ybar;
+        centroid_get_centroid(NULL, &ybar);
+
+        sprintf(buf, "Tracao:     %.3f MPa", t.sig / 1e6);
+        gfx_PrintStringXY(buf, 2, 24);
+        sprintf(buf, "  x=%.3f m, fibra %s", t.x, (t.y > ybar) ? "de cima" : "de baixo");
+        gfx_PrintStringXY(buf, 2, 36);
+        sprintf(buf, "  M=%.3f N*m", t.M);
+        gfx_PrintStringXY(buf, 2, 48);
+        sprintf(buf, "Compressao: %.3f MPa", c.sig / 1e6);
+        gfx_PrintStringXY(buf, 2, 68);
+        sprintf(buf, "  x=%.3f m, fibra %s", c.x, (c.y > ybar) ? "de cima" : "de baixo");
+        gfx_PrintStringXY(buf, 2, 80);
+        sprintf(buf, "  M=%.3f N*m", c.M);
+        gfx_PrintStringXY(buf, 2, 92);
+        gfx_PrintStringXY("Secao assimetrica: a tracao max.", 2, 116);
+        gfx_PrintStringXY("pode vir do M negativo.", 2, 128);
+        gfx_PrintStringXY("ENTER etapas  2 campo  CLEAR volta", 2, 220);
+
+        wait_key_release();
+        int op = 0;
+        while (!op) {
+            check_on_exit();
+            tela_scan();
+            if (pressed_once(kb_KeyEnter)) op = 1;
+            else if (pressed_once(kb_Key2)) op = 2;
+            else if (pressed_once(kb_KeyClear)) op = 3;
+            entrada_dormir();
+        }
+        if (op == 1) {
+            /* etapas para o ponto de maior |SIG| */
+            const PontoCritico *g = (fabs(t.sig) >= fabs(c.sig)) ? &t : &c;
+            if (viga_tem_normal()) mostrar_NM(g->N, g->M, g->x, 1);
+            else                   mostrar_etapas(g->M, g->x, 2);
+        } else if (op == 2) {
+            mostrar_campo();
+        } else {
+            return;
         }
     }
 }
@@ -488,7 +920,7 @@ static void mostrar_etapas(double M, double x_pos, int origem) {
 
 /* sem formato definido -> só avisa e volta */
 static void fluxo_sem_formato(void) {
-    gfx_FillScreen(0);
+    tela_limpar();
     gfx_SetTextFGColor(1);
     gfx_PrintStringXY("=== MAX. TENSOES ===", 2, 2);
     gfx_PrintStringXY("Nenhum FORMATO definido.", 2, 24);
@@ -501,37 +933,43 @@ static void fluxo_sem_formato(void) {
 /* formato OK, mas sem viga definida */
 static void fluxo_sem_viga(void) {
     while (1) {
-        gfx_FillScreen(0);
+        tela_limpar();
         gfx_SetTextFGColor(1);
-        gfx_PrintStringXY("=== MAX. TENSOES ===", 2, 2);
-        gfx_PrintStringXY("Formato: OK (centroide & Ix)", 2, 20);
-        gfx_PrintStringXY("Viga: NAO DEFINIDA", 2, 32);
-
-        gfx_PrintStringXY("1) SIG com M conhecido", 2, 52);
-        gfx_PrintStringXY("2) Calcular M em viga simples", 2, 64);
-        gfx_PrintStringXY("3) Adicionar viga (voltar)", 2, 76);
-        gfx_PrintStringXY("ENTER/1..3 escolhe, CLEAR volta", 2, 96);
+        tela_texto("=== MAX. TENSOES ===", 2, 2);
+        tela_texto("Formato: OK (centroide & Ix)", 2, 20);
+        tela_texto("Viga: NAO DEFINIDA", 2, 32);
+
+        tela_texto("1) SIG com M conhecido", 2, 52);
+        tela_texto("2) Calcular M em viga simples", 2, 64);
+        tela_texto("3) Adicionar viga (voltar)", 2, 76);
+        tela_texto("4) TAU com V conhecido", 2, 88);
+        tela_texto("5) Flexao obliqua (Mx, My)", 2, 100);
+        tela_texto("6) SIG com N e M (flexao comp.)", 2, 112);
+        tela_texto("ENTER/1..6 escolhe, CLEAR volta", 2, 132);
 
         uint8_t opt = 0;
         while (!opt) {
             check_on_exit();
-            kb_Scan();
+            tela_scan();
             if (pressed_once(kb_Key1) || pressed_once(kb_KeyEnter)) opt = 1;
             else if (pressed_once(kb_Key2)) opt = 2;
             else if (pressed_once(kb_Key3) || pressed_once(kb_KeyClear)) opt = 3;
-            delay(10);
+            else if (pressed_once(kb_Key4)) opt = 4;
+            else if (pressed_once(kb_Key5)) opt = 5;
+            else if (pressed_once(kb_Key6)) opt = 6;
+            entrada_dormir();
         }
 
         if (opt == 1) {
             /* Momento informado direto */
-            double M = input_double("Momento M (Nm, sinal conv.):");
+            real_t M = input_double("Momento M (Nm, sinal conv.):");
             mostrar_etapas(M, 0.0, 0);
         }
         else if (opt == 2) {
             /* Viga simplesmente apoiada com carga P em a (bem basico) */
-            double unit_len = centroid_get_unit_factor();
+            real_t unit_len = centroid_get_unit_factor();
             const char *uname = centroid_get_unit_name();
-            double L;
+            real_t L;
             while (1) {
                 char buf_unit[STRBUF];
                 snprintf(buf_unit, sizeof buf_unit, "Viga simples: comprimento L (%s):", uname ? uname : "m");
@@ -539,22 +977,37 @@ static void fluxo_sem_viga(void) {
                 if (L > 0.0) break;
             }
 
-            double P = input_double("Carga pontual P (N, >0 p/baixo):");
+            real_t P = input_double("Carga pontual P (N, >0 p/baixo):");
 
-            double a;
+            real_t a;
             while (1) {
                 char buf[STRBUF];
-                double L_show = (unit_len > 0.0) ? (L / unit_len) : L;
+                real_t L_show = (unit_len > 0.0) ? (L / unit_len) : L;
                 sprintf(buf, "Posicao da carga a (%s, 0..%.3f):", uname ? uname : "m", L_show);
                 a = input_double(buf) * unit_len;
                 if (a >= 0.0 && a <= L) break;
             }
 
             /* Reacao em A (RA) e momento max sob a carga: Mmax = RA*a */
-            double RA = P * (L - a) / L;
-            double Mmax = RA * a; /* sagging positivo */
+            real_t RA = P * (L - a) / L;
+            real_t Mmax = RA * a; /* sagging positivo */
             mostrar_etapas(Mmax, a, 3);
         }
+        else if (opt == 4) {
+            real_t V = input_double("Cortante V (N):");
+            mostrar_cisalhamento(V, 0.0, 0);
+            wait_enter_or_clear_tens();
+        }
+        else if (opt == 5) {
+            real_t Mx = input_double("Mx (Nm, sagging > 0):");
+            real_t My = input_double("My (Nm, tracao em x>0 se > 0):");
+            mostrar_biaxial(Mx, My);
+        }
+        else if (opt == 6) {
+            real_t N = input_double("Normal N (N, tracao > 0):");
+            real_t M = input_double("Momento M (Nm, sinal conv.):");
+            mostrar_NM(N, M, 0.0, 0);
+        }
         else {
             /* opt 3: apenas volta pro menu principal (pra criar viga) */
             return;
@@ -565,48 +1018,74 @@ static void fluxo_sem_viga(void) {
 /* formato OK e viga definida */
 static void fluxo_com_viga(void) {
     while (1) {
-        gfx_FillScreen(0);
+        tela_limpar();
         gfx_SetTextFGColor(1);
-        gfx_PrintStringXY("=== MAX. TENSOES ===", 2, 2);
-        gfx_PrintStringXY("Formato: OK", 2, 20);
-        gfx_PrintStringXY("Viga: DEFINIDA", 2, 32);
-
-        gfx_PrintStringXY("1) SIG em ponto x da viga", 2, 52);
-        gfx_PrintStringXY("2) SIG max (tracao/comp.)", 2, 64);
-        gfx_PrintStringXY("3) Voltar", 2, 76);
-        gfx_PrintStringXY("ENTER/1..3 escolhe, CLEAR volta", 2, 96);
+        tela_texto("=== MAX. TENSOES ===", 2, 2);
+        tela_texto("Formato: OK", 2, 20);
+        tela_texto("Viga: DEFINIDA", 2, 32);
+
+        tela_texto("1) SIG em ponto x da viga", 2, 52);
+        tela_texto("2) SIG max (tracao/comp.)", 2, 64);
+        tela_texto("3) TAU max (cisalhamento)", 2, 76);
+        tela_texto("4) Dimensionar perfil (catalogo)", 2, 88);
+        tela_texto("5) Sensibilidades (d/db,h,P,a)", 2, 100);
+        tela_texto("6) Flexao obliqua (Mx viga + My)", 2, 112);
+        tela_texto("7) Voltar", 2, 124);
+        tela_texto("ENTER/1..7 escolhe, CLEAR volta", 2, 144);
 
         uint8_t opt = 0;
         while (!opt) {
             check_on_exit();
-            kb_Scan();
+            tela_scan();
             if (pressed_once(kb_Key1) || pressed_once(kb_KeyEnter)) opt = 1;
             else if (pressed_once(kb_Key2)) opt = 2;
-            else if (pressed_once(kb_Key3) || pressed_once(kb_KeyClear)) opt = 3;
-            delay(10);
+            else if (pressed_once(kb_Key3)) opt = 3;
+            else if (pressed_once(kb_Key4)) opt = 4;
+            else if (pressed_once(kb_Key5)) opt = 5;
+            else if (pressed_once(kb_Key6)) opt = 6;
+            else if (pressed_once(kb_Key7) || pressed_once(kb_KeyClear)) opt = 7;
+            entrada_dormir();
         }
 
         if (opt == 1) {
             /* SIG em ponto x da viga (usa M(x) da viga) */
-            double unit_len = viga_get_unit_factor();
+            real_t unit_len = viga_get_unit_factor();
             const char *uname = viga_get_unit_name();
-            double L = viga_get_length();
-            double x;
+            real_t L = viga_get_length();
+            real_t x;
             while (1) {
                 char buf[STRBUF];
-                double L_show = (unit_len > 0.0) ? (L / unit_len) : L;
+                real_t L_show = (unit_len > 0.0) ? (L / unit_len) : L;
                 sprintf(buf, "Posicao x (%s, 0..%.3f):", uname, L_show);
                 x = input_double(buf) * unit_len;
                 if (x >= 0.0 && x <= L) break;
             }
-            double M = viga_momento_em(x);
-            mostrar_etapas(M, x, 1);
+            real_t M = viga_momento_em(x);
+            if (viga_tem_normal()) mostrar_NM(viga_normal_em(x), M, x, 1);
+            else                   mostrar_etapas(M, x, 1);
         }
         else if (opt == 2) {
-            /* SIG max -> Mmax ao longo da viga */
-            double xM = 0.0;
-            double M = viga_momento_max_abs(&xM);
-            mostrar_etapas(M, xM, 2);
+            /* SIG max -> extremos de M contra as duas fibras */
+            mostrar_criticos();
+        }
+        else if (opt == 3) {
+            /* TAU max -> estacao de |V| maximo ao longo da viga */
+            real_t xV = 0.0;
+            real_t V = viga_cortante_max_abs(&xV);
+            mostrar_cisalhamento(V, xV, 1);
+            wait_enter_or_clear_tens();
+        }
+        else if (opt == 4) {
+            mostrar_dimensionamento();
+        }
+        else if (opt == 5) {
+            mostrar_sensibilidades();
+        }
+        else if (opt == 6) {
+            /* Mx = M da viga na estação de |M| máximo; My informado */
+            real_t Mx = viga_momento_max_abs(NULL);
+            real_t My = input_double("My (Nm, tracao em x>0 se > 0):");
+            mostrar_biaxial(Mx, My);
         }
         else {
             return;
@@ -0,0 +1,178 @@
+/*  src/uniao.c
+    Varredura (sweep-line) da UNIAO de retangulos para MECSOL - TI-84 Plus CE
+    Área exata de  U(materiais) - U(recortes), sem contar sobreposição duas vezes.
+
+    Eventos = bordas dos retângulos ordenadas no eixo varrido;
+    árvore de segmentos sobre as coordenadas (comprimidas) do eixo transversal.
+    Cada nó guarda quantos materiais/recortes cobrem todo o seu intervalo e
+    os momentos (Int dt, Int t dt, Int t^2 dt) da parte coberta. O(n log n).
+
+    Autor: https://github.com/daniSoares08
+*/
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "secao.h"
+
+#define MAX_COORD (2*UNIAO_MAX_RECT)
+#define MAX_NOS   (4*MAX_COORD)
+
+typedef struct {
+    real_t s;            /* posição no eixo varrido     */
+    real_t t0, t1;       /* intervalo no eixo transversal */
+    signed char delta;   /* +1 entra, -1 sai            */
+    unsigned char rec;
+} Evento;
+
+typedef struct {
+    unsigned char cm, cr;   /* coberturas inteiras por material / recorte */
+    real_t r[3];            /* momentos da parte coberta por recorte       */
+    real_t mr[3];           /* momentos da parte material e NÃO recorte    */
+} No;
+
+static real_t  ts[MAX_COORD];
+static int     nts = 0;
+static Evento  evs[MAX_COORD];
+static No      arv[MAX_NOS];
+
+static int cmp_double(const void *a, const void *b) {
+    real_t x = *(const real_t *)a, y = *(const real_t *)b;
+    return (x > y) - (x < y);
+}
+
+static int cmp_evento(const void *a, const void *b) {
+    const Evento *x = a, *y = b;
+    return (x->s > y->s) - (x->s < y->s);
+}
+
+/* momentos do intervalo inteiro [ts[l], ts[r+1]] */
+static void cheio(int l, int r, real_t m[3]) {
+    real_t a = ts[l], b = ts[r+1];
+    m[0] = b - a;
+    m[1] = (b*b - a*a) / 2.0;
+    m[2] = (b*b*b - a*a*a) / 3.0;
+}
+
+static void recalcular(int no, int l, int r) {
+    No *p = &arv[no];
+    bool folha = (l == r);
+    real_t f[3];
+    cheio(l, r, f);
+
+    for (int k = 0; k < 3; k++) {
+        if (p->cr) {
+            p->r[k]  = f[k];
+            p->mr[k] = 0.0;
+            continue;
+        }
+        p->r[k] = folha ? 0.0 : arv[2*no].r[k] + arv[2*no+1].r[k];
+        if (p->cm)  p->mr[k] = f[k] - p->r[k];
+        else        p->mr[k] = folha ? 0.0 : arv[2*no].mr[k] + arv[2*no+1].mr[k];
+    }
+}
+
+static void atualizar(int no, int l, int r, int ql, int qr, int delta, bool rec) {
+    if (qr < l || r < ql) return;
+    if (ql <= l && r <= qr) {
+        if (rec) arv[no].cr += delta;
+        else     arv[no].cm += delta;
+    } else {
+        int m = (l + r) / 2;
+        atualizar(2*no,   l,   m, ql, qr, delta, rec);
+        atualizar(2*no+1, m+1, r, ql, qr, delta, rec);
+    }
+    recalcular(no, l, r);
+}
+
+/* índice de t em ts[] (t sempre está lá: busca binária) */
+static int indice(real_t t) {
+    int lo = 0, hi = nts - 1;
+    while (lo < hi) {
+        int m = (lo + hi) / 2;
+        if (ts[m] < t) lo = m + 1; else hi = m;
+    }
+    return lo;
+}
+
+int uniao_faixas(const Rect *r, int n, int eixo_y, Faixa *out, int max) {
+    int nev = 0;
+    nts = 0;
+    if (n > UNIAO_MAX_RECT) n = UNIAO_MAX_RECT;
+
+    for (int i = 0; i < n; i++) {
+        real_t x0 = r[i].x0, x1 = r[i].x0 + r[i].w;
+        real_t y0 = r[i].y0, y1 = r[i].y0 + r[i].h;
+        if (x1 < x0) { real_t t = x0; x0 = x1; x1 = t; }
+        if (y1 < y0) { real_t t = y0; y0 = y1; y1 = t; }
+        if (x1 - x0 <= 0.0 || y1 - y0 <= 0.0) continue;
+
+        real_t s0 = eixo_y ? y0 : x0, s1 = eixo_y ? y1 : x1;
+        real_t t0 = eixo_y ? x0 : y0, t1 = eixo_y ? x1 : y1;
+        evs[nev++] = (Evento){ s0, t0, t1, +1, r[i].rec };
+        evs[nev++] = (Evento){ s1, t0, t1, -1, r[i].rec };
+        ts[nts++] = t0;
+        ts[nts++] = t1;
+    }
+    if (nev == 0) return 0;
+
+    /* comprime coordenadas transversais */
+    qsort(ts, nts, sizeof ts[0], cmp_double);
+    int m = 0;
+    for (int i = 0; i < nts; i++) if (m == 0 || ts[i] > ts[m-1]) ts[m++] = ts[i];
+    nts = m;
+    if (nts < 2) return 0;
+
+    qsort(evs, nev, sizeof evs[0], cmp_evento);
+    memset(arv, 0, sizeof(arv[0]) * 4 * nts);
+
+    const int ult = nts - 2;   /* último intervalo elementar */
+    int nf = 0;
+    real_t s_ant = evs[0].s;
+
+    for (int i = 0; i < nev; i++) {
+        const Evento *e = &evs[i];
+        if (e->s > s_ant) {
+            const No *raiz = &arv[1];
+            if (raiz->mr[0] > 0.0 && nf < max) {
+                out[nf++] = (Faixa){ s_ant, e->s, raiz->mr[0], raiz->mr[1], raiz->mr[2] };
+            }
+            s_ant = e->s;
+        }
+        int a = indice(e->t0), b = indice(e->t1) - 1;
+        if (a <= b) atualizar(1, 0, ult, a, b, e->delta, e->rec != 0);
+    }
+    return nf;
+}
+
+void uniao_momentos(const Rect *r, int n, SecMomentos *m) {
+    static Faixa f[MAX_COORD];
+    memset(m, 0, sizeof *m);
+
+    /* varre em x: cada faixa [a,b] tem largura constante em y */
+    int nf = uniao_faixas(r, n, 0, f, MAX_COORD);
+    for (int i = 0; i < nf; i++) {
+        real_t a = f[i].a, b = f[i].b;
+        real_t w  = b - a;
+        real_t x1 = (b*b - a*a) / 2.0;        /* Int x dx   */
+        real_t x2 = (b*b*b - a*a*a) / 3.0;    /* Int x^2 dx */
+        m->A   += w  * f[i].m0;
+        m->Sx  += x1 * f[i].m0;
+        m->Sy  += w  * f[i].m1;
+        m->Ixx += w  * f[i].m2;
+        m->Iyy += x2 * f[i].m0;
+        m->Ixy += x1 * f[i].m1;
+    }
+    if (nf > 0) {
+        m->xmin = f[0].a;
+        m->xmax = f[nf-1].b;
+    }
+
+    /* limites em y saem da varredura transversal (primeira/última faixa) */
+    nf = uniao_faixas(r, n, 1, f, MAX_COORD);
+    if (nf > 0) {
+        m->ymin = f[0].a;
+        m->ymax = f[nf-1].b;
+    }
+}
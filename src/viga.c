@@ -7,52 +7,59 @@
 #include <graphx.h>
 #include <keypadc.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
 
-#include "beam.h"   /* já integrado ao projeto, reservado p/ usos futuros */
-
-/* ======== API externa do módulo FORMATO (centroid.c) ======== */
-int centroid_has_figure(void);
-const char *centroid_get_unit_name(void);
-double centroid_get_unit_factor(void);
+#include "beam.h"   /* forma fechada dos casos de livro (reconhecer_caso) */
+#include "secao.h"  /* API do módulo FORMATO (centroid.c) */
+#include "dual.h"   /* derivadas: viga_momento_dual */
+#include "tela.h"   /* buffer duplo: tela_limpar / tela_sujar / tela_scan */
+#include "entrada.h" /* editor numérico comum */
+#ifdef MECSOL_FIXO
+#include "fixo.h"   /* V/M em ponto fixo (make FIXO=1) */
+#endif
 
 #define MAX_APOIOS   2
 #define MAX_CARGAS_P 8
 #define MAX_CARGAS_D 6
 #define MAX_MOMENTOS 6
+#define MAX_CARGAS_N 4
 #define MAX_PONTOS   20
 #define STRBUF       64
 
 #define MAX_EVENTS (2 + MAX_APOIOS + MAX_CARGAS_P + 2*MAX_CARGAS_D + MAX_MOMENTOS)
 #define MAX_LABELS (2*MAX_EVENTS + 2)
 
-typedef struct { double factor; const char *name; } UnitOpt;
+typedef struct { real_t factor; const char *name; } UnitOpt;
 
 /* --- estruturas --- */
-typedef struct { char tipo; double pos; double Ry; double Ma; } Apoio;
-typedef struct { double pos; double F; } CargaP;
-typedef struct { double x_ini, x_fim, f_ini, f_fim; } CargaD;
-typedef struct { double pos, val; } Momento;
+typedef struct { char tipo; real_t pos; real_t Ry; real_t Ma; } Apoio;
+typedef struct { real_t pos; real_t F; } CargaP;
+typedef struct { real_t x_ini, x_fim, f_ini, f_fim; } CargaD;
+typedef struct { real_t pos, val; } Momento;
+typedef struct { real_t pos; real_t F; } CargaN;   /* axial, F > 0 aponta p/ +x */
 
 typedef struct {
-    double xq;        /* ponto de amostragem (ev[i]±EPS) para posicionar a letra */
-    double val;       /* V(xq) ou M(xq) */
+    real_t xq;        /* ponto de amostragem (ev[i]±EPS) para posicionar a letra */
+    real_t val;       /* V(xq) ou M(xq) */
     char   tag[4];    /* "A","B",...,"Z","AA"... */
 } PtLabel;
 
 /* --- armazenamento global --- */
-static double L = 0.0;
+static real_t L = 0.0;
 static Apoio   apoios[MAX_APOIOS];     static int n_apoios   = 0;
 static CargaP  cargas_p[MAX_CARGAS_P]; static int n_cargas_p = 0;
 static CargaD  cargas_d[MAX_CARGAS_D]; static int n_cargas_d = 0;
 static Momento momentos[MAX_MOMENTOS]; static int n_momentos = 0;
-static double  pontos[MAX_PONTOS];     static int n_pontos   = 0;
-static double  unit_formato = 1.0;     /* fator da figura (para metro) */
+static CargaN  cargas_n[MAX_CARGAS_N]; static int n_cargas_n = 0;
+static real_t  pontos[MAX_PONTOS];     static int n_pontos   = 0;
+static unsigned viga_revisao = 0;      /* muda a cada edição do modelo (caches comparam) */
+static real_t  unit_formato = 1.0;     /* fator da figura (para metro) */
 static const char *unit_formato_name = "m";
-static double  unit_viga = 1.0;        /* fator escolhido para exibição/entrada */
+static real_t  unit_viga = 1.0;        /* fator escolhido para exibição/entrada */
 static const char *unit_viga_name = "m";
 
 static const UnitOpt UOPTS[] = {
@@ -63,7 +70,7 @@ static const UnitOpt UOPTS[] = {
 
 /* ======== UTIL GRÁFICO ======== */
 static void scr_clear(void) {
-    gfx_FillScreen(0); /* branco (paleta 0) */
+    tela_limpar(); /* branco (paleta 0) */
 }
 static void scr_print_xy(const char *s, int x, int y) {
     gfx_PrintStringXY(s, x, y);
@@ -71,19 +78,13 @@ static void scr_print_xy(const char *s, int x, int y) {
 
 /* ======== TECLADO / HINT ======== */
 
-static inline uint8_t any_key_down(void) {
-    return (kb_Data[1] | kb_Data[2] | kb_Data[3] | kb_Data[4] |
-            kb_Data[5] | kb_Data[6] | kb_Data[7] | (kb_On ? 0xFF : 0));
-}
-
 static void wait_key_release(void) {
-    do { kb_Scan(); } while (any_key_down());
-    delay(20);
+    entrada_soltar();
 }
 
 /* ON sai sempre */
 static inline void check_on_exit(void) {
-    kb_Scan();
+    tela_scan();
     if (kb_On) {
         gfx_End();
         exit(0);
@@ -95,7 +96,8 @@ static void draw_hint(const char *s) {
     gfx_SetColor(0); /* barra inferior branca */
     gfx_FillRectangle(0, 220, 320, 12);
     gfx_SetTextFGColor(1); /* texto preto */
-    gfx_PrintStringXY(s, 2, 220);
+    tela_texto(s, 2, 220); /* hints são sempre literais */
+    tela_sujar(0, 220, 320, 12);
 }
 
 /* retorna true se ENTER, false se CLEAR */
@@ -103,26 +105,26 @@ static bool wait_enter_or_clear(const char *hint) {
     draw_hint(hint);
     wait_key_release();
     while (1) {
-        kb_Scan();
+        tela_scan();
         if (kb_On) { gfx_End(); exit(0); }
         if (kb_Data[6] & kb_Enter) { wait_key_release(); return true; }
         if (kb_Data[6] & kb_Clear) { wait_key_release(); return false; }
-        delay(10);
+        entrada_dormir();
     }
 }
 
 static void wait_enter_or_on(void) {
     wait_key_release();
     while (1) {
-        kb_Scan();
+        tela_scan();
         if (kb_On) { gfx_End(); exit(0); }
         if (kb_Data[6] & kb_Enter) { wait_key_release(); return; }
-        delay(10);
+        entrada_dormir();
     }
 }
 
 /* ======== UNIDADES ======== */
-static void set_unit_viga_by_factor(double factor) {
+static void set_unit_viga_by_factor(real_t factor) {
     unit_viga = factor;
     unit_viga_name = "m";
     for (size_t i = 0; i < sizeof(UOPTS)/sizeof(UOPTS[0]); i++) {
@@ -145,15 +147,15 @@ static void sync_units_with_formato(void) {
     set_unit_viga_by_factor(unit_formato);
 }
 
-static inline double len_to_calc(double val_in_unit) {
+static inline real_t len_to_calc(real_t val_in_unit) {
     return val_in_unit * unit_viga; /* converte p/ metro */
 }
 
-static inline double len_from_calc(double val_m) {
+static inline real_t len_from_calc(real_t val_m) {
     return (unit_viga > 0.0) ? (val_m / unit_viga) : val_m;
 }
 
-static inline double distload_to_calc(double val_in_unit) {
+static inline real_t distload_to_calc(real_t val_in_unit) {
     /* N/(unidade) -> N/m */
     return (unit_viga > 0.0) ? (val_in_unit / unit_viga) : val_in_unit;
 }
@@ -173,13 +175,13 @@ static void selecionar_unidade_viga(void) {
 
     while (1) {
         check_on_exit();
-        kb_Scan();
+        tela_scan();
         if (kb_Data[6] & kb_Clear) { wait_key_release(); return; }
         if (kb_Data[6] & kb_Enter) { set_unit_viga_by_factor(unit_formato); wait_key_release(); return; }
         if (kb_Data[3] & kb_1) { set_unit_viga_by_factor(UOPTS[0].factor); wait_key_release(); return; }
         if (kb_Data[4] & kb_2) { set_unit_viga_by_factor(UOPTS[1].factor); wait_key_release(); return; }
         if (kb_Data[5] & kb_3) { set_unit_viga_by_factor(UOPTS[2].factor); wait_key_release(); return; }
-        delay(10);
+        entrada_dormir();
     }
 }
 
@@ -187,57 +189,10 @@ static void selecionar_unidade_viga(void) {
 
 /* lê linha SEM limpar tela inteira; prompt no topo, buffer em y=60 */
 static void input_line_inline(char *buf, int maxlen, const char *prompt) {
-    const int px = 2,  py = 2;
-    const int bx = 2,  by = 60;
-    const int bw = 316, bh = 12;
-
-    int idx = 0;
-    buf[0] = '\0';
-    bool dirty = true; /* só redesenha quando muda */
-
     gfx_SetTextFGColor(1);
-    gfx_PrintStringXY(prompt, px, py);
-
-    while (1) {
-        if (dirty) {
-            /* limpa faixa do buffer e redesenha texto digitado */
-            gfx_SetColor(0);
-            gfx_FillRectangle(bx, by, bw, bh);
-            gfx_SetTextFGColor(1);
-            gfx_PrintStringXY(buf, bx, by);
-            dirty = false;
-        }
-
-        kb_Scan();
-        if (kb_On) { gfx_End(); exit(0); }
-
-        /* ENTER e CLEAR/DEL */
-        if (kb_Data[6] & kb_Enter) { wait_key_release(); buf[idx] = '\0'; return; }
-        if ((kb_Data[6] & kb_Clear) || (kb_Data[1] & kb_Del)) {
-            if (idx > 0) { buf[--idx] = '\0'; dirty = true; }
-            wait_key_release();
-            continue;
-        }
-
-        /* dígitos, ponto, menos */
-        char cc = 0;
-        if      (kb_Data[3] & kb_0) cc='0';
-        else if (kb_Data[3] & kb_1) cc='1';
-        else if (kb_Data[4] & kb_2) cc='2';
-        else if (kb_Data[5] & kb_3) cc='3';
-        else if (kb_Data[3] & kb_4) cc='4';
-        else if (kb_Data[4] & kb_5) cc='5';
-        else if (kb_Data[5] & kb_6) cc='6';
-        else if (kb_Data[3] & kb_7) cc='7';
-        else if (kb_Data[4] & kb_8) cc='8';
-        else if (kb_Data[5] & kb_9) cc='9';
-        else if (kb_Data[4] & kb_DecPnt) cc='.';               /* ponto */
-        else if ((kb_Data[6] & kb_Sub) || (kb_Data[5] & kb_Chs)) cc='-'; /* menos */
-
-        if (cc && idx < maxlen-1) { buf[idx++] = cc; buf[idx] = '\0'; dirty = true; wait_key_release(); }
-
-        delay(10);
-    }
+    gfx_PrintStringXY(prompt, 2, 2);
+    tela_sujar(0, 2, 320, 8);
+    entrada_linha(buf, maxlen, 2, 60, 316);
 }
 
 /* limpa tela e chama o inline */
@@ -247,7 +202,7 @@ static void input_line_screen(char *buf, int maxlen, const char *prompt) {
 }
 
 /* numéricos */
-static double input_double(const char *prompt) {
+static real_t input_double(const char *prompt) {
     char s[STRBUF];
     while (1) {
         input_line_screen(s, STRBUF, prompt);
@@ -276,22 +231,22 @@ static void calcular_reacoes(void) {
     if (n_apoios == 1 && apoios[0].tipo == 'E') {
         /* Cantilever (engastada) */
         Apoio *a = &apoios[0];
-        double pos_e = a->pos;
-        double soma_fy = 0.0, soma_me = 0.0;
+        real_t pos_e = a->pos;
+        real_t soma_fy = 0.0, soma_me = 0.0;
 
         for (int i=0;i<n_cargas_p;i++) {
             soma_fy += cargas_p[i].F;
             soma_me += cargas_p[i].F * (cargas_p[i].pos - pos_e);
         }
         for (int i=0;i<n_cargas_d;i++) {
-            double x_ini = cargas_d[i].x_ini, x_fim = cargas_d[i].x_fim;
-            double f_ini = cargas_d[i].f_ini, f_fim = cargas_d[i].f_fim;
-            double Ld = x_fim - x_ini;
-            double F_ret = f_ini * Ld;
-            double F_tri = 0.5 * (f_fim - f_ini) * Ld;
+            real_t x_ini = cargas_d[i].x_ini, x_fim = cargas_d[i].x_fim;
+            real_t f_ini = cargas_d[i].f_ini, f_fim = cargas_d[i].f_fim;
+            real_t Ld = x_fim - x_ini;
+            real_t F_ret = f_ini * Ld;
+            real_t F_tri = 0.5 * (f_fim - f_ini) * Ld;
             soma_fy += (F_ret + F_tri);
-            double pos_ret = x_ini + Ld/2.0;
-            double pos_tri = x_ini + 2.0*Ld/3.0;
+            real_t pos_ret = x_ini + Ld/2.0;
+            real_t pos_tri = x_ini + 2.0*Ld/3.0;
             soma_me += F_ret * (pos_ret - pos_e);
             soma_me += F_tri * (pos_tri - pos_e);
         }
@@ -310,20 +265,20 @@ static void calcular_reacoes(void) {
     }
     else if (n_apoios == 2) {
         Apoio *A = &apoios[0], *B = &apoios[1];
-        double pos_a = A->pos, pos_b = B->pos;
-        double soma_ma = 0.0, soma_fy = 0.0;
+        real_t pos_a = A->pos, pos_b = B->pos;
+        real_t soma_ma = 0.0, soma_fy = 0.0;
 
         for (int i=0;i<n_cargas_p;i++) {
             soma_fy += cargas_p[i].F;
             soma_ma += cargas_p[i].F * (cargas_p[i].pos - pos_a);
         }
         for (int i=0;i<n_cargas_d;i++) {
-            double x_ini=cargas_d[i].x_ini, x_fim=cargas_d[i].x_fim;
-            double f_ini=cargas_d[i].f_ini, f_fim=cargas_d[i].f_fim;
-            double Ld = x_fim - x_ini;
-            double F_res = (f_ini + f_fim)/2.0 * Ld;
+            real_t x_ini=cargas_d[i].x_ini, x_fim=cargas_d[i].x_fim;
+            real_t f_ini=cargas_d[i].f_ini, f_fim=cargas_d[i].f_fim;
+            real_t Ld = x_fim - x_ini;
+            real_t F_res = (f_ini + f_fim)/2.0 * Ld;
             soma_fy += F_res;
-            double pos_res;
+            real_t pos_res;
             if ((f_ini + f_fim) != 0.0)
                 pos_res = x_ini + (Ld * (2.0*f_fim + f_ini)) / (3.0 * (f_ini + f_fim));
             else pos_res = x_ini + Ld/2.0;
@@ -350,26 +305,118 @@ static void calcular_reacoes(void) {
     (void)wait_enter_or_clear("ENTER/CLEAR: voltar");
 }
 
+#ifdef MECSOL_FIXO
+static FxViga viga_fx;   /* refeito a cada resolver_reacoes */
+
+static void montar_fixo(void) {
+    FxModelo m;
+    m.L = L;
+    m.na = n_apoios;
+    m.engaste = (n_apoios == 1 && apoios[0].tipo == 'E');
+    for (int i = 0; i < n_apoios; i++) m.ap_pos[i] = apoios[i].pos;
+    m.np = n_cargas_p;
+    for (int i = 0; i < n_cargas_p; i++) { m.p_pos[i] = cargas_p[i].pos; m.p_F[i] = cargas_p[i].F; }
+    m.nd = n_cargas_d;
+    for (int i = 0; i < n_cargas_d; i++) {
+        m.d_a[i]  = cargas_d[i].x_ini; m.d_b[i]  = cargas_d[i].x_fim;
+        m.d_qa[i] = cargas_d[i].f_ini; m.d_qb[i] = cargas_d[i].f_fim;
+    }
+    m.nm = n_momentos;
+    for (int i = 0; i < n_momentos; i++) { m.m_pos[i] = momentos[i].pos; m.m_val[i] = momentos[i].val; }
+    fixo_viga_montar(&m, &viga_fx);
+}
+#endif
+
+/* ======== CASOS DE LIVRO ========
+   Biapoiada + uma carga pontual, biapoiada + q uniforme em todo o vão e
+   balanço + carga na ponta têm reações, M máximo, flecha e rotação em
+   forma fechada (beam.c): dispensa a busca por trechos e a integração
+   numérica. Qualquer outro modelo segue pelo caminho geral. */
+static Beam caso;
+static bool caso_ok = false;
+static bool caso_espelho = false;   /* balanço com engaste em x = L: x -> L - x */
+
+static bool caso_reconhecer(void) {
+    const real_t tol = 1e-6 * L;
+    caso_ok = false;
+    caso_espelho = false;
+    if (L <= 0.0 || n_momentos != 0) return false;   /* cargas axiais não entram em V/M */
+
+    if (n_apoios == 2) {
+        real_t p0 = apoios[0].pos, p1 = apoios[1].pos;
+        bool nas_pontas = (fabs(p0) <= tol && fabs(p1 - L) <= tol) ||
+                          (fabs(p1) <= tol && fabs(p0 - L) <= tol);
+        if (!nas_pontas) return false;
+        if (n_cargas_p == 1 && n_cargas_d == 0) {
+            /* beam_init prende a em [0, L]: carga fora do vão vai ao caso geral */
+            real_t a = cargas_p[0].pos;
+            if (a < -tol || a > L + tol) return false;
+            beam_init(&caso, L, 1.0, cargas_p[0].F, a);
+            caso_ok = true;
+        } else if (n_cargas_p == 0 && n_cargas_d == 1) {
+            const CargaD *d = &cargas_d[0];
+            if (fabs(d->x_ini) > tol || fabs(d->x_fim - L) > tol) return false;
+            if (fabs(d->f_fim - d->f_ini) > 1e-6 * fabs(d->f_ini)) return false;
+            beam_init_q(&caso, L, 1.0, d->f_ini);
+            caso_ok = true;
+        }
+    } else if (n_apoios == 1 && apoios[0].tipo == 'E') {
+        if (n_cargas_p != 1 || n_cargas_d != 0) return false;
+        real_t pe = apoios[0].pos, pc = cargas_p[0].pos;
+        if (fabs(pe) <= tol && fabs(pc - L) <= tol) caso_espelho = false;
+        else if (fabs(pe - L) <= tol && fabs(pc) <= tol) caso_espelho = true;
+        else return false;
+        beam_init_balanco(&caso, L, 1.0, cargas_p[0].F);
+        caso_ok = true;
+    }
+    return caso_ok;
+}
+
+/* posição no referencial de beam.c -> posição na viga */
+static inline real_t caso_x(real_t xb) {
+    return caso_espelho ? L - xb : xb;
+}
+
+/* reações do caso reconhecido, nas convenções de calcular_forcas_internas_em */
+static void caso_reacoes(void) {
+    if (n_apoios == 1) {
+        apoios[0].Ry = caso.RA;
+        apoios[0].Ma = caso_espelho ? -caso.MA : caso.MA;
+        return;
+    }
+    bool a_em_0 = apoios[0].pos < apoios[1].pos;
+    apoios[0].Ry = a_em_0 ? caso.RA : caso.RB;
+    apoios[1].Ry = a_em_0 ? caso.RB : caso.RA;
+    apoios[0].Ma = apoios[1].Ma = 0.0;
+}
+
 /* resolve reações sem UI, para uso em diagramas */
 static bool resolver_reacoes(void) {
+    if (caso_reconhecer()) {
+        caso_reacoes();
+#ifdef MECSOL_FIXO
+        montar_fixo();
+#endif
+        return true;
+    }
     if (n_apoios == 1 && apoios[0].tipo == 'E') {
         Apoio *a = &apoios[0];
-        double pos_e = a->pos;
-        double soma_fy = 0.0, soma_me = 0.0;
+        real_t pos_e = a->pos;
+        real_t soma_fy = 0.0, soma_me = 0.0;
 
         for (int i=0;i<n_cargas_p;i++) {
             soma_fy += cargas_p[i].F;
             soma_me += cargas_p[i].F * (cargas_p[i].pos - pos_e);
         }
         for (int i=0;i<n_cargas_d;i++) {
-            double x_ini=cargas_d[i].x_ini, x_fim=cargas_d[i].x_fim;
-            double f_ini=cargas_d[i].f_ini, f_fim=cargas_d[i].f_fim;
-            double Ld = x_fim - x_ini;
-            double F_ret = f_ini * Ld;
-            double F_tri = 0.5 * (f_fim - f_ini) * Ld;
+            real_t x_ini=cargas_d[i].x_ini, x_fim=cargas_d[i].x_fim;
+            real_t f_ini=cargas_d[i].f_ini, f_fim=cargas_d[i].f_fim;
+            real_t Ld = x_fim - x_ini;
+            real_t F_ret = f_ini * Ld;
+            real_t F_tri = 0.5 * (f_fim - f_ini) * Ld;
             soma_fy += (F_ret + F_tri);
-            double pos_ret = x_ini + Ld/2.0;
-            double pos_tri = x_ini + 2.0*Ld/3.0;
+            real_t pos_ret = x_ini + Ld/2.0;
+            real_t pos_tri = x_ini + 2.0*Ld/3.0;
             soma_me += F_ret * (pos_ret - pos_e);
             soma_me += F_tri * (pos_tri - pos_e);
         }
@@ -377,24 +424,27 @@ static bool resolver_reacoes(void) {
 
         a->Ry = soma_fy;
         a->Ma = -soma_me;
+#ifdef MECSOL_FIXO
+        montar_fixo();
+#endif
         return true;
     } else if (n_apoios == 2) {
         Apoio *A=&apoios[0], *B=&apoios[1];
-        double pos_a=A->pos, pos_b=B->pos;
+        real_t pos_a=A->pos, pos_b=B->pos;
         if (fabs(pos_b-pos_a) < 1e-9) return false;
 
-        double soma_ma=0.0, soma_fy=0.0;
+        real_t soma_ma=0.0, soma_fy=0.0;
         for (int i=0;i<n_cargas_p;i++) {
             soma_fy += cargas_p[i].F;
             soma_ma += cargas_p[i].F * (cargas_p[i].pos - pos_a);
         }
         for (int i=0;i<n_cargas_d;i++) {
-            double x_ini=cargas_d[i].x_ini, x_fim=cargas_d[i].x_fim;
-            double f_ini=cargas_d[i].f_ini, f_fim=cargas_d[i].f_fim;
-            double Ld=x_fim-x_ini;
-            double F_res=(f_ini+f_fim)/2.0 * Ld;
+            real_t x_ini=cargas_d[i].x_ini, x_fim=cargas_d[i].x_fim;
+            real_t f_ini=cargas_d[i].f_ini, f_fim=cargas_d[i].f_fim;
+            real_t Ld=x_fim-x_ini;
+            real_t F_res=(f_ini+f_fim)/2.0 * Ld;
             soma_fy += F_res;
-            double pos_res;
+            real_t pos_res;
             if ((f_ini+f_fim)!=0.0)
                 pos_res = x_ini + (Ld*(2.0*f_fim+f_ini))/(3.0*(f_ini+f_fim));
             else pos_res = x_ini + Ld/2.0;
@@ -405,59 +455,42 @@ static bool resolver_reacoes(void) {
         B->Ry = soma_ma / (pos_b - pos_a);
         A->Ry = soma_fy - B->Ry;
         A->Ma = 0.0; B->Ma = 0.0;
+#ifdef MECSOL_FIXO
+        montar_fixo();
+#endif
         return true;
     }
     return false;
 }
 
-/* V(x), M(x) em um ponto x (versão modernizada) */
-static void calcular_forcas_internas_em(double x, double *V_out, double *M_out) {
-    double V = 0.0, M = 0.0;
-
-    /* reações/momentos de apoio */
-    for (int i=0;i<n_apoios;i++) {
-        Apoio *a = &apoios[i];
-        if (a->pos < x) {
-            V += a->Ry;
-            /* Momento fletor deve seguir a convencao sagging positivo.
-               A contribuicao da reacao cortante aumenta (nao diminui)
-               o momento conforme a distancia do apoio. */
-            M += a->Ry * (x - a->pos);
-            M += a->Ma;
-        }
-    }
-
-    /* cargas pontuais */
-    for (int i=0;i<n_cargas_p;i++) {
-        if (cargas_p[i].pos <= x) {
-            V -= cargas_p[i].F;
-            M += cargas_p[i].F * (x - cargas_p[i].pos);
-        }
-    }
+/* parcela de V(x), M(x) das cargas distribuídas e dos momentos aplicados
+   (não depende das reações nem das cargas pontuais) */
+static void parcela_dist_momentos_em(real_t x, real_t *V_out, real_t *M_out) {
+    real_t V = 0.0, M = 0.0;
 
     /* cargas distribuídas lineares */
     for (int i=0;i<n_cargas_d;i++) {
-        double a  = cargas_d[i].x_ini;
-        double b  = cargas_d[i].x_fim;
-        double qa = cargas_d[i].f_ini;
-        double qb = cargas_d[i].f_fim;
+        real_t a  = cargas_d[i].x_ini;
+        real_t b  = cargas_d[i].x_fim;
+        real_t qa = cargas_d[i].f_ini;
+        real_t qb = cargas_d[i].f_fim;
         if (x <= a) continue;
 
-        double Ld  = (b - a);
-        double m   = (fabs(Ld) > 1e-12) ? (qb - qa) / Ld : 0.0;
+        real_t Ld  = (b - a);
+        real_t m   = (fabs(Ld) > 1e-12) ? (qb - qa) / Ld : 0.0;
 
         if (x <= b) {
             /* dentro da faixa: integra de a..x */
-            double dx = x - a;
-            double Fseg = qa*dx + 0.5*m*dx*dx;
+            real_t dx = x - a;
+            real_t Fseg = qa*dx + 0.5*m*dx*dx;
             V -= Fseg;
             /* Carga distribuida reduz o momento (sinal oposto ao Ry) */
             M -= 0.5*qa*dx*dx + (1.0/6.0)*m*dx*dx*dx;
         } else {
             /* após o fim: usa resultante total e seu baricentro */
-            double Ftot = qa*Ld + 0.5*m*Ld*Ld;                 /* = (qa+qb)/2 * Ld */
+            real_t Ftot = qa*Ld + 0.5*m*Ld*Ld;                 /* = (qa+qb)/2 * Ld */
             V -= Ftot;
-            double Ma_about_a = 0.5*qa*Ld*Ld + (1.0/3.0)*m*Ld*Ld*Ld;  /* ∫ t q(t) dt */
+            real_t Ma_about_a = 0.5*qa*Ld*Ld + (1.0/3.0)*m*Ld*Ld*Ld;  /* ∫ t q(t) dt */
             M -= (x - a)*Ftot - Ma_about_a;                 /* = -Ftot*(x - x_res) */
         }
     }
@@ -474,8 +507,50 @@ static void calcular_forcas_internas_em(double x, double *V_out, double *M_out)
     *M_out = M;
 }
 
+/* V(x), M(x) em um ponto x (versão modernizada) */
+static void calcular_forcas_internas_em(real_t x, real_t *V_out, real_t *M_out) {
+#ifdef MECSOL_FIXO
+    if (viga_fx.ok) {
+        fixo_viga_VM(&viga_fx, x, V_out, M_out);
+        return;
+    }
+#endif
+    real_t V = 0.0, M = 0.0;
+
+    /* reações/momentos de apoio */
+    for (int i=0;i<n_apoios;i++) {
+        Apoio *a = &apoios[i];
+        if (a->pos < x) {
+            V += a->Ry;
+            /* Momento fletor deve seguir a convencao sagging positivo.
+               A contribuicao da reacao cortante aumenta (nao diminui)
+               o momento conforme a distancia do apoio. */
+            M += a->Ry * (x - a->pos);
+            M += a->Ma;
+        }
+    }
+
+    /* cargas pontuais (>0 p/ baixo): mesmo sinal da distribuida, reduz M.
+       Somar aqui fazia M(L) != 0 na viga biapoiada. */
+    for (int i=0;i<n_cargas_p;i++) {
+        if (cargas_p[i].pos <= x) {
+            V -= cargas_p[i].F;
+            M -= cargas_p[i].F * (x - cargas_p[i].pos);
+        }
+    }
+
+    /* cargas distribuídas e momentos aplicados */
+    real_t Vd, Md;
+    parcela_dist_momentos_em(x, &Vd, &Md);
+    V += Vd;
+    M += Md;
+
+    *V_out = V;
+    *M_out = M;
+}
+
 /* mapeia [0..L] -> [x0..x0+w_beam] (usa L global) */
-static inline int xmap(double xm, int x0, int w_beam) {
+static inline int xmap(real_t xm, int x0, int w_beam) {
     if (L <= 0) return x0;
     if (xm < 0) xm = 0;
     else if (xm > L) xm = L;
@@ -534,7 +609,7 @@ static void desenhar_viga_menu(void) {
     /* === cargas pontuais (setas) === */
     for (int i = 0; i < n_cargas_p; i++) {
         int x = xmap(cargas_p[i].pos, x0, w_beam);
-        double F = cargas_p[i].F;
+        real_t F = cargas_p[i].F;
         int len = 18;          /* comprimento do traço */
         int hw  = 5, hh = 7;   /* cabeça da seta */
 
@@ -564,7 +639,7 @@ static void desenhar_viga_menu(void) {
     for (int i = 0; i < n_momentos; i++) {
         int x = xmap(momentos[i].pos, x0, w_beam);
         int r = 10, cy = y_beam - 20;
-        double m = momentos[i].val;
+        real_t m = momentos[i].val;
 
         gfx_Circle(x, cy, r);
         if (m >= 0) {
@@ -585,64 +660,8 @@ static void desenhar_viga_menu(void) {
 
 /* === construção de eventos / labels / escalas === */
 
-static void compute_scale(bool isV, const double *ev, int nev,
-                          double *p_amax, double *p_u, const char **p_unit) {
-    const int SAMP = 12;
-    double minv=0,maxv=0; bool first=true;
-    for (int i=0;i<nev-1;i++){
-        for (int k=0;k<=SAMP;k++){
-            double x = ev[i] + (ev[i+1]-ev[i])*(double)k/(double)SAMP;
-            double V,M; calcular_forcas_internas_em(x,&V,&M);
-            double y = isV?V:M;
-            if(first){minv=maxv=y; first=false;} else { if(y<minv)minv=y; if(y>maxv)maxv=y; }
-        }
-    }
-    double amax=fmax(fabs(minv),fabs(maxv)); if(amax<1e-9) amax=1.0;
-    bool use_k = (amax>=1000.0);
-    double u = use_k? 1.0/1000.0 : 1.0;
-    *p_amax = amax; *p_u = u;
-    *p_unit = isV ? (use_k? "kN":"N") : (use_k? "kN*m":"N*m");
-}
-
-static int build_labels_for(bool isV, const double *ev, int nev,
-                            PtLabel *Lab, int maxL) {
-    const double EPS = 1e-4;
-    int n = 0; double V, M;
-
-    /* início (x = 0+) */
-    if (n < maxL) {
-        double xq = ev[0] + EPS;
-        if (xq > L) xq = L;
-        calcular_forcas_internas_em(xq, &V, &M);
-        Lab[n++] = (PtLabel){ xq, isV ? V : M, "" };
-    }
-
-    /* eventos internos: valor à esquerda e à direita de cada salto */
-    for (int i = 1; i < nev - 1 && n + 2 <= maxL; i++) {
-        double xl = ev[i] - EPS; if (xl < 0) xl = 0;
-        double xr = ev[i] + EPS; if (xr > L) xr = L;
-
-        calcular_forcas_internas_em(xl, &V, &M);
-        Lab[n++] = (PtLabel){ xl, isV ? V : M, "" };
-
-        calcular_forcas_internas_em(xr, &V, &M);
-        Lab[n++] = (PtLabel){ xr, isV ? V : M, "" };
-    }
-
-    /* fim (x = L-) */
-    if (n < maxL) {
-        double xq = ev[nev - 1] - EPS; if (xq < 0) xq = 0;
-        calcular_forcas_internas_em(xq, &V, &M);
-        Lab[n++] = (PtLabel){ xq, isV ? V : M, "" };
-    }
-
-    /* gera A, B, C... */
-    for (int i = 0; i < n; i++) make_label(i, Lab[i].tag);
-    return n;
-}
-
 /* junta todos os pontos-chave do eixo x e devolve quantidade (ordenada e única) */
-static int coletar_eventos(double *xs, int maxn) {
+static int coletar_eventos(real_t *xs, int maxn) {
     int n = 0;
     if (L <= 0) return 0;
 
@@ -664,7 +683,7 @@ static int coletar_eventos(double *xs, int maxn) {
 
     /* ordena (insertion sort) */
     for (int i=1; i<n; i++) {
-        double v = xs[i]; int j = i-1;
+        real_t v = xs[i]; int j = i-1;
         while (j>=0 && xs[j] > v) { xs[j+1] = xs[j]; j--; }
         xs[j+1] = v;
     }
@@ -676,84 +695,698 @@ static int coletar_eventos(double *xs, int maxn) {
     return m;
 }
 
-/* desenha 1 diagrama (V se isV=true, M se false), com marcações verticais */
-static void desenhar_diagrama_letras(bool isV,
-                                     const double *ev, int nev,
-                                     const PtLabel *Lab, int nlab,
-                                     double amax, double u, const char *unit_title) {
-    const int gx0 = 12, gx1 = 308;
-    const int gy_top = 40, gy_bot = 220;
-    const int gw = gx1 - gx0, gh = gy_bot - gy_top;
-    const int y0 = gy_bot - gh/2;
-    const int SAMP = 12;
-    const double EPS = 1e-4;
+/* ======== CACHE DOS DIAGRAMAS ========
+   V e M são amostrados juntos uma vez por modelo (viga_revisao): y de cada
+   coluna, degraus nos eventos, letras e escala. Alternar V/M, diagrama/
+   legenda, zoom ou deslocamento só redesenha a partir daqui, sem
+   calcular_forcas_internas_em.
+   Zoom: as colunas finas (DG_ZMAX por coluna da tela) formam o nível 0 de
+   uma pirâmide min/max; o nível k junta 2^k colunas finas. Cada quadro lê
+   só DG_W+1 entradas do nível do zoom atual. */
+#define DG_X0   12
+#define DG_X1   308
+#define DG_W    (DG_X1 - DG_X0)
+#define DG_YTOP 40
+#define DG_YBOT 220
+#define DG_H    (DG_YBOT - DG_YTOP)
+#define DG_Y0   (DG_YBOT - DG_H/2)
+#define DG_YFAIXA 20    /* topo da faixa redesenhada sem título/rodapé (pan, arraste) */
+#define DG_BLOCO 16     /* colunas por reancoragem das diferenças progressivas */
+#define DG_ZMAX  4      /* zoom máximo (potência de 2) */
+#define DG_NIV   3      /* níveis: 0 (zoom DG_ZMAX) .. DG_NIV-1 (viga inteira) */
+#define DG_BASE  (DG_W * DG_ZMAX)
+#define DG_PIR   ((DG_BASE/2 + 1) + (DG_BASE/4 + 1))   /* níveis 1 e 2 */
 
-    scr_clear();
-    gfx_SetTextFGColor(1);
+typedef struct {
+    real_t      amax, u;
+    const char *unit;
+    PtLabel     lab[MAX_LABELS];
+    int         nlab;
+    int16_t     base[DG_BASE + 1];                    /* nível 0: y (pixel) por coluna fina */
+    int16_t     pmin[DG_PIR], pmax[DG_PIR];           /* níveis 1.., em sequência */
+    int16_t     deg_e[MAX_EVENTS], deg_d[MAX_EVENTS]; /* y à esquerda/direita do evento */
+    real_t      pico;                                 /* maior |valor| nas colunas finas */
+    int         pico_col;
+} DiagCache;
+
+/* polinômio de um trecho na forma de Newton (t em colunas finas, relativo a c0) */
+typedef struct {
+    int    c0, c1;          /* colunas finas cobertas */
+    real_t xa, xb;          /* eventos que limitam o trecho [m] */
+    real_t s[4];            /* nós */
+    real_t d[2][4];         /* diferenças divididas de V e M */
+} DiagPoli;
+
+/* Arraste de uma carga (what-if): fora da faixa [lo, hi] varrida pela carga
+   V e M mudam só por um termo linear (reações e a própria carga), que é
+   somado aos polinômios já ajustados; só os trechos dentro da faixa são
+   reamostrados. */
+typedef struct {
+    real_t lo, hi;
+    real_t dM_dir;                          /* ΔM constante à direita de hi */
+    real_t dR[MAX_APOIOS], dMa[MAX_APOIOS]; /* Δ das reações */
+} DiagDelta;
+
+static DiagCache diag[2];             /* [0] = V, [1] = M */
+static real_t    diag_ev[MAX_EVENTS];
+static int       diag_nev = 0;
+static DiagPoli  diag_poli[MAX_EVENTS];
+static DiagPoli  diag_poli_ant[MAX_EVENTS];   /* cópia p/ reaproveitar no arraste */
+static int       diag_npoli = 0;
+static unsigned  diag_rev = 0;
+static bool      diag_ok = false;
+
+/* vista: zoom (1..DG_ZMAX) e 1a coluna visível, em colunas do zoom atual */
+static int diag_zoom = 1;
+static int diag_off  = 0;
+
+/* o que as setas fazem na tela do diagrama */
+enum { VISTA_LIVRE, VISTA_CURSOR, VISTA_ARRASTE };
+
+/* carga arrastada: 0..n_cargas_p-1 pontuais, depois momentos; -1 nenhuma */
+static int arr_sel = -1;
+/* posições digitadas, guardadas ao entrar no arraste e repostas ao sair */
+static real_t arr_orig[MAX_CARGAS_P + MAX_MOMENTOS];
+
+static inline int16_t diag_py(real_t val, real_t ys) {
+    return (int16_t)(DG_Y0 - (int)round(val * ys));
+}
 
-    double ys = (gh*0.42) / amax;
+/* Ajusta V e M do trecho [a, b]. No trecho V é no máximo quadrático e M
+   cúbico (carga distribuída linear): 4 amostras internas dão o polinômio
+   exato; depois cada coluna sai só com somas (diag_percorrer). */
+static void diag_ajustar(DiagPoli *pp, real_t a, real_t b) {
+    const real_t EPS = 1e-4;
+    const real_t h = L / DG_BASE;          /* largura de uma coluna fina [m] */
+    real_t V, M;
+
+    for (int k = 0; k < 4; k++) {
+        real_t x = (b - a <= 2.0*EPS) ? 0.5*(a + b)      /* trecho mínimo: constante */
+                 : (a + EPS) + (b - a - 2.0*EPS) * (real_t)k / 3.0;
+        calcular_forcas_internas_em(x, &V, &M);
+        pp->s[k] = x / h - (real_t)pp->c0;   /* t relativo à 1a coluna: menos cancelamento em float */
+        pp->d[0][k] = V;
+        pp->d[1][k] = M;
+    }
+    for (int q = 0; q < 2; q++) {
+        real_t *d = pp->d[q];
+        if (b - a <= 2.0*EPS) { d[1] = d[2] = d[3] = 0.0; continue; }
+        /* diferenças divididas in loco: d = [f0, f01, f012, f0123] */
+        for (int ordem = 1; ordem < 4; ordem++)
+            for (int k = 3; k >= ordem; k--)
+                d[k] = (d[k] - d[k-1]) / (pp->s[k] - pp->s[k-ordem]);
+    }
+}
 
-    char title[64];
-    sprintf(title, isV ? "Diagrama de Cortante V(x) [%s]" : "Diagrama de Momento M(x) [%s]", unit_title);
-    gfx_PrintStringXY(title, 8, 8);
+/* soma ao trecho o termo linear do arraste: V += b, M += a0 + b*x */
+static void diag_somar_linear(DiagPoli *pp, const DiagDelta *dl) {
+    const real_t h = L / DG_BASE;
+    real_t a0 = (pp->xa >= dl->hi) ? dl->dM_dir : 0.0, b = 0.0;
+    for (int i = 0; i < n_apoios; i++) {
+        if (apoios[i].pos > pp->xa) continue;   /* apoio à direita: não entra */
+        b  += dl->dR[i];
+        a0 += dl->dMa[i] - dl->dR[i] * apoios[i].pos;
+    }
+    /* linear -> só as duas primeiras diferenças divididas mudam (x = (c0 + t) h) */
+    pp->d[0][0] += b;
+    pp->d[1][0] += a0 + b * h * ((real_t)pp->c0 + pp->s[0]);
+    pp->d[1][1] += b * h;
+}
+
+/* Percorre as colunas do trecho por diferenças progressivas (a 3a é
+   constante), reancorando a cada DG_BLOCO colunas para limitar o erro
+   acumulado em float. dst == NULL: só mede. Devolve o maior |valor| e
+   grava sua coluna em *pcol. */
+static real_t diag_percorrer(const DiagPoli *pp, int q, int16_t *dst, real_t ys, int *pcol) {
+    const real_t *d = pp->d[q], *s = pp->s;
+    real_t amax = -1.0;
+
+    for (int cb = pp->c0; cb <= pp->c1; cb += DG_BLOCO) {
+        real_t p[4];
+        for (int k = 0; k < 4; k++) {
+            real_t t = (real_t)(cb - pp->c0 + k);
+            p[k] = d[0] + (t - s[0]) * (d[1] + (t - s[1]) * (d[2] + (t - s[2]) * d[3]));
+        }
+        real_t d0 = p[0];
+        real_t d1 = p[1] - p[0];
+        real_t d2 = p[2] - 2.0*p[1] + p[0];
+        real_t d3 = p[3] - 3.0*p[2] + 3.0*p[1] - p[0];
+        int ce = cb + DG_BLOCO - 1;
+        if (ce > pp->c1) ce = pp->c1;
+        for (int c = cb; c <= ce; c++) {
+            if (dst) dst[c] = diag_py(d0, ys);
+            if (fabs(d0) > amax) { amax = fabs(d0); *pcol = c; }
+            d0 += d1; d1 += d2; d2 += d3;
+        }
+    }
+    return amax;
+}
+
+/* nível k da pirâmide: vetores min/max com DG_BASE/2^k + 1 entradas */
+static void diag_nivel(const DiagCache *dc, int k, const int16_t **mn, const int16_t **mx) {
+    if (k == 0) { *mn = *mx = dc->base; return; }
+    int ofs = 0;
+    for (int j = 1; j < k; j++) ofs += (DG_BASE >> j) + 1;
+    *mn = dc->pmin + ofs;
+    *mx = dc->pmax + ofs;
+}
+
+static void diag_piramide(DiagCache *dc) {
+    const int16_t *fmn = dc->base, *fmx = dc->base;
+    int nf = DG_BASE + 1, ofs = 0;
+    for (int k = 1; k < DG_NIV; k++) {
+        int n = (DG_BASE >> k) + 1;
+        int16_t *mn = dc->pmin + ofs, *mx = dc->pmax + ofs;
+        for (int j = 0; j < n; j++) {
+            int f = 2*j;
+            mn[j] = fmn[f]; mx[j] = fmx[f];
+            if (f + 1 < nf) {
+                if (fmn[f+1] < mn[j]) mn[j] = fmn[f+1];
+                if (fmx[f+1] > mx[j]) mx[j] = fmx[f+1];
+            }
+        }
+        fmn = mn; fmx = mx; nf = n; ofs += n;
+    }
+}
+
+/* Particiona as colunas finas pelos eventos (x em (a, b]; a 1a também pega
+   x = 0) e ajusta cada trecho. Com dl, trechos de mesmas bordas fora da
+   faixa do arraste são reaproveitados com o termo linear somado. */
+static void diag_trechos(const DiagDelta *dl) {
+    const real_t *ev = diag_ev;
+    const int nev = diag_nev;
+    int na = 0, j = 0, c = 0;
+
+    if (dl) {
+        memcpy(diag_poli_ant, diag_poli, diag_npoli * sizeof *diag_poli);
+        na = diag_npoli;
+    }
+    diag_npoli = 0;
+    for (int i = 0; i < nev - 1 && c <= DG_BASE; i++) {
+        real_t a = ev[i], b = ev[i+1];
+        int c1 = (i == nev - 2) ? DG_BASE : (int)floor(b * DG_BASE / L);
+        if (c1 > DG_BASE) c1 = DG_BASE;
+        if (c1 < c) continue;
+        DiagPoli *pp = &diag_poli[diag_npoli++];
+        while (j < na && diag_poli_ant[j].xa < a) j++;
+        if (dl && j < na && (b <= dl->lo || a >= dl->hi) &&
+            diag_poli_ant[j].xa == a && diag_poli_ant[j].xb == b && diag_poli_ant[j].c0 == c) {
+            *pp = diag_poli_ant[j];
+            diag_somar_linear(pp, dl);
+        } else {
+            pp->c0 = c; pp->c1 = c1;
+            pp->xa = a; pp->xb = b;
+            diag_ajustar(pp, a, b);
+        }
+        c = c1 + 1;
+    }
+}
+
+/* letras, degraus, pixels e pirâmide a partir dos trechos. reescalar =
+   false mantém amax (o gráfico não "pula" durante um arraste). */
+static void diag_desenho(bool reescalar) {
+    const real_t EPS = 1e-4;
+    const real_t *ev = diag_ev;
+    const int nev = diag_nev;
+
+    /* lados de cada evento: degraus e letras saem das mesmas avaliações */
+    real_t ve[MAX_EVENTS], vd[MAX_EVENTS], me[MAX_EVENTS], md[MAX_EVENTS];
+    for (int i = 0; i < nev; i++) {
+        calcular_forcas_internas_em(fmax(0.0, ev[i] - EPS), &ve[i], &me[i]);
+        calcular_forcas_internas_em(fmin(L, ev[i] + EPS),   &vd[i], &md[i]);
+    }
+
+    for (int k = 0; k < 2; k++) {
+        DiagCache *dc = &diag[k];
+        const real_t *e = k ? me : ve, *d = k ? md : vd;
+        int n = 0;
+        /* início (x = 0+), lados dos eventos internos, fim (x = L-) */
+        dc->lab[n++] = (PtLabel){ fmin(L, ev[0] + EPS), d[0], "" };
+        for (int i = 1; i < nev - 1 && n + 2 <= MAX_LABELS - 1; i++) {
+            dc->lab[n++] = (PtLabel){ fmax(0.0, ev[i] - EPS), e[i], "" };
+            dc->lab[n++] = (PtLabel){ fmin(L, ev[i] + EPS),   d[i], "" };
+        }
+        dc->lab[n++] = (PtLabel){ fmax(0.0, ev[nev-1] - EPS), e[nev-1], "" };
+        for (int i = 0; i < n; i++) make_label(i, dc->lab[i].tag);
+        dc->nlab = n;
+
+        /* escala: 1a passada só mede, 2a grava os pixels */
+        int col;
+        if (reescalar) {
+            real_t amax = 0.0;
+            for (int j = 0; j < diag_npoli; j++) {
+                real_t a = diag_percorrer(&diag_poli[j], k, NULL, 0.0, &col);
+                if (a > amax) amax = a;
+            }
+            for (int i = 0; i < n; i++)
+                if (fabs(dc->lab[i].val) > amax) amax = fabs(dc->lab[i].val);
+            if (amax < 1e-9) amax = 1.0;
+            bool use_k = (amax >= 1000.0);
+            dc->amax = amax;
+            dc->u = use_k ? 1.0/1000.0 : 1.0;
+            dc->unit = (k == 0) ? (use_k ? "kN" : "N") : (use_k ? "kN*m" : "N*m");
+        }
+
+        real_t ys = (DG_H*0.42) / dc->amax;
+        dc->pico = 0.0; dc->pico_col = 0;
+        for (int j = 0; j < diag_npoli; j++) {
+            real_t a = diag_percorrer(&diag_poli[j], k, dc->base, ys, &col);
+            if (a > dc->pico) { dc->pico = a; dc->pico_col = col; }
+        }
+        diag_piramide(dc);
+        for (int i = 0; i < nev; i++) {
+            dc->deg_e[i] = diag_py(e[i], ys);
+            dc->deg_d[i] = diag_py(d[i], ys);
+        }
+    }
+}
+
+/* refaz o cache se o modelo mudou; false se não há o que desenhar */
+static bool diag_montar(void) {
+    if (diag_ok && diag_rev == viga_revisao) return true;
+    diag_ok = false;
+    if (!resolver_reacoes()) return false;
+    diag_nev = coletar_eventos(diag_ev, MAX_EVENTS);
+    if (diag_nev < 2) return false;
+
+    diag_trechos(NULL);
+    diag_desenho(true);
+
+    diag_rev = viga_revisao;
+    diag_ok = true;
+    return true;
+}
+
+/* nível da pirâmide do zoom atual (zoom DG_ZMAX = nível 0) */
+static int diag_nivel_zoom(void) {
+    int niv = 0;
+    for (int z = diag_zoom; z < DG_ZMAX; z *= 2) niv++;
+    return niv;
+}
+
+/* x [m] -> coluna da tela na vista atual (pode cair fora do gráfico) */
+static inline int diag_xtela(real_t x) {
+    return DG_X0 + (int)(x * (DG_W * diag_zoom) / L + 0.5) - diag_off;
+}
+
+/* troca o zoom mantendo o centro da vista */
+static void diag_set_zoom(int z) {
+    if (z < 1) z = 1;
+    if (z > DG_ZMAX) z = DG_ZMAX;
+    long centro = (long)(diag_off + DG_W/2) * z / diag_zoom;
+    diag_zoom = z;
+    diag_off = (int)(centro - DG_W/2);
+    if (diag_off > DG_W*(z - 1)) diag_off = DG_W*(z - 1);
+    if (diag_off < 0) diag_off = 0;
+}
+
+static void diag_pan(int dcol) {
+    diag_off += dcol;
+    if (diag_off > DG_W*(diag_zoom - 1)) diag_off = DG_W*(diag_zoom - 1);
+    if (diag_off < 0) diag_off = 0;
+}
+
+static inline void diag_horiz(int c0, int y, int c1) {
+    if (c0 >= 0 && y >= DG_YTOP && y < DG_YBOT) gfx_HorizLine(DG_X0 + c0, y, c1 - c0);
+}
+
+/* Curva a partir de n colunas min/max: cada coluna cobre do seu min ao max,
+   esticada até encostar na coluna anterior. Colunas seguidas de 1 pixel no
+   mesmo y viram uma só HorizLine; as demais, um VertLine. Tudo recortado à
+   faixa [DG_YTOP, DG_YBOT). */
+static void diag_rasterizar(const int16_t *mn, const int16_t *mx, int n) {
+    int run_c = -1, run_y = 0;          /* trecho horizontal pendente */
+    for (int c = 0; c < n; c++) {
+        int lo = mn[c], hi = mx[c];
+        if (c > 0) {
+            if (lo > mx[c-1]) lo = mx[c-1] + 1;
+            if (hi < mn[c-1]) hi = mn[c-1] - 1;
+        }
+        if (lo == hi && run_c >= 0 && lo == run_y) continue;
+        diag_horiz(run_c, run_y, c);
+        run_c = -1;
+        if (lo == hi) { run_c = c; run_y = lo; continue; }
+        if (lo < DG_YTOP)    lo = DG_YTOP;
+        if (hi > DG_YBOT-1)  hi = DG_YBOT - 1;
+        if (hi >= lo) gfx_VertLine(DG_X0 + c, lo, hi - lo + 1);
+    }
+    diag_horiz(run_c, run_y, n);
+}
+
+/* desenha 1 diagrama (V se isV=true, M se false) a partir do cache */
+/* so_faixa: título e rodapé já estão no buffer (mesmo V/M e modo), só a
+   faixa entre eles é apagada e volta ao LCD */
+/* trecho visível "a-b" (unidade da viga) */
+static void diag_faixa_txt(char *s, size_t n) {
+    snprintf(s, n, "%.2f-%.2f", len_from_calc(L * diag_off / (DG_W * diag_zoom)),
+             len_from_calc(L * (diag_off + DG_W) / (DG_W * diag_zoom)));
+}
+
+/* "[a-b]" para a caixa de leitura; vazio sem zoom */
+static void diag_faixa_leitura(char *s, size_t n) {
+    char fx[20];
+    s[0] = '\0';
+    if (diag_zoom < 2) return;
+    diag_faixa_txt(fx, sizeof fx);
+    snprintf(s, n, "[%s]", fx);
+}
+
+static void desenhar_diagrama_letras(bool isV, int modo, bool so_faixa) {
+    const DiagCache *dc = &diag[isV ? 0 : 1];
+    const real_t ys = (DG_H*0.42) / dc->amax;
+
+    if (so_faixa) {
+        gfx_SetColor(0);
+        gfx_FillRectangle(0, DG_YFAIXA, 320, DG_YBOT - DG_YFAIXA);
+        tela_sujar(0, DG_YFAIXA, 320, DG_YBOT - DG_YFAIXA);
+    } else {
+        scr_clear();
+    }
+    gfx_SetTextFGColor(1);
+
+    if (!so_faixa) {
+        char title[64];
+        sprintf(title, isV ? "Diagrama de Cortante V(x) [%s]" : "Diagrama de Momento M(x) [%s]", dc->unit);
+        gfx_PrintStringXY(title, 8, 8);
+    }
+    /* com cursor/arraste a caixa de leitura ocupa esta linha e leva a faixa */
+    if (diag_zoom > 1 && modo == VISTA_LIVRE) {
+        char zb[48], fx[24];
+        diag_faixa_txt(fx, sizeof fx);
+        snprintf(zb, sizeof zb, "zoom %dx  %s %s", diag_zoom, fx, unit_viga_name);
+        gfx_PrintStringXY(zb, 8, 22);
+    }
 
     gfx_SetColor(1);
-    gfx_HorizLine(gx0, y0, gw);
+    gfx_HorizLine(DG_X0, DG_Y0, DG_W);
 
     /* marcações verticais */
-    for (int i=0;i<nev;i++) {
-        int xx = xmap(ev[i], gx0, gw);
-        gfx_VertLine(xx, gy_top, gh);
-    }
-
-    /* curva por trechos (evita amostrar exatamente no evento) */
-    int lx=0, ly=0; bool have=false;
-    for (int i=0;i<nev-1;i++){
-        double a=ev[i], b=ev[i+1], Ls=a+EPS, Rs=b-EPS; if(Rs<=Ls) continue;
-        for (int k=0;k<=SAMP;k++){
-            double x = Ls + (Rs-Ls)*(double)k/(double)SAMP;
-            double V,M; calcular_forcas_internas_em(x,&V,&M);
-            double val = isV?V:M;
-            int px=xmap(x,gx0,gw), py=y0-(int)round(val*ys);
-            if(have) gfx_Line(lx,ly,px,py);
-            lx=px; ly=py; have=true;
+    for (int i=0;i<diag_nev;i++) {
+        int xx = diag_xtela(diag_ev[i]);
+        if (xx >= DG_X0 && xx <= DG_X1) gfx_VertLine(xx, DG_YTOP, DG_H);
+    }
+
+    /* carga selecionada p/ arraste: seta no topo do gráfico */
+    if (modo == VISTA_ARRASTE && arr_sel >= 0) {
+        real_t xs = (arr_sel < n_cargas_p) ? cargas_p[arr_sel].pos : momentos[arr_sel - n_cargas_p].pos;
+        int xx = diag_xtela(xs);
+        if (xx >= DG_X0 && xx <= DG_X1) {
+            gfx_SetColor(2);
+            gfx_FillTriangle(xx, DG_YTOP + 6, xx - 4, DG_YTOP, xx + 4, DG_YTOP);
+            gfx_SetColor(1);
         }
     }
+
+    /* curva: nível da pirâmide do zoom atual */
+    const int16_t *mn, *mx;
+    diag_nivel(dc, diag_nivel_zoom(), &mn, &mx);
+    diag_rasterizar(mn + diag_off, mx + diag_off, DG_W + 1);
+
     /* degraus visíveis */
-    for (int i=0;i<nev;i++){
-        double xl=fmax(0.0,ev[i]-EPS), xr=fmin(L,ev[i]+EPS);
-        double Vl,Ml,Vr,Mr; calcular_forcas_internas_em(xl,&Vl,&Ml); calcular_forcas_internas_em(xr,&Vr,&Mr);
-        double vl=isV?Vl:Ml, vr=isV?Vr:Mr;
-        int px=xmap(ev[i],gx0,gw), yl=y0-(int)round(vl*ys), yr=y0-(int)round(vr*ys);
+    for (int i=0;i<diag_nev;i++){
+        int px=diag_xtela(diag_ev[i]), yl=dc->deg_e[i], yr=dc->deg_d[i];
+        if (px < DG_X0 || px > DG_X1) continue;
         if(yl!=yr){ int y1=(yl<yr?yl:yr), h=abs(yr-yl)+1; gfx_FillRectangle(px-1,y1,3,h); }
     }
 
     /* letras (A,B,...) nos pontos amostrados: início, lados dos eventos e fim */
-    for (int i=0;i<nlab;i++){
-        int px = xmap(Lab[i].xq, gx0, gw);
-        int py = y0 - (int)round(Lab[i].val * ys);
-        int y  = (Lab[i].val >= 0) ? (py - 10) : (py + 2);
-        if (y < 8) y = 8; if (y > 230) y = 230;
-
-        int w = (int)strlen(Lab[i].tag) * 6;
+    for (int i=0;i<dc->nlab;i++){
+        const PtLabel *lb = &dc->lab[i];
+        int px = diag_xtela(lb->xq);
+        if (px < DG_X0 || px > DG_X1) continue;
+        int py = diag_py(lb->val, ys);
+        int y  = (lb->val >= 0) ? (py - 10) : (py + 2);
+        if (y < DG_YFAIXA)   y = DG_YFAIXA;
+        if (y > DG_YBOT - 9) y = DG_YBOT - 9;
+
+        int w = (int)strlen(lb->tag) * 6;
         int tx = px - w/2; if (tx < 2) tx = 2; if (tx + w > 318) tx = 318 - w;
 
         gfx_SetTextFGColor(2); /* vermelho claro */
-        gfx_PrintStringXY(Lab[i].tag, tx, y);
+        gfx_PrintStringXY(lb->tag, tx, y);
         gfx_SetTextFGColor(1); /* volta para preto */
     }
 
-    /* rodapé: ENTER alterna V/M, setas alternam diagrama/legenda */
+    /* rodapé: ENTER alterna V/M, +/- zoom, setas movem, cima/baixo legenda */
+    if (so_faixa) return;
     gfx_SetColor(0);
     gfx_FillRectangle(0,220,320,12);
     gfx_SetTextFGColor(1);
-    gfx_PrintStringXY(isV ? "ENTER: M(x)   LEFT/RIGHT: legenda"
-                          : "ENTER: V(x)   LEFT/RIGHT: legenda", 2, 220);
+    if (modo == VISTA_CURSOR)
+        tela_texto("<>:cursor  +/-:zoom  TRACE/CLEAR:sair", 2, 220);
+    else if (modo == VISTA_ARRASTE)
+        tela_texto("<>:mover  2nd:proxima  CLEAR:desfaz", 2, 220);
+    else
+        tela_texto(isV ? "ENTER:M  +/-:zoom  <>:mover  ^v:legenda"
+                       : "ENTER:V  +/-:zoom  <>:mover  ^v:legenda", 2, 220);
+}
+
+/* ======== CURSOR (TRACE) ========
+   Cursor vertical sobre o diagrama: esquerda/direita andam uma coluna e a
+   caixa de leitura mostra x, V, M e sig nas fibras extremas. O trecho sob
+   o cursor é seguido incrementalmente em diag_poli, então cada quadro é
+   O(1) (um Horner no polinômio do trecho). Só a faixa do cursor, salva e
+   restaurada, e a caixa de leitura são redesenhadas. */
+#define CUR_Y 20        /* caixa de leitura: 2 linhas entre o título e o gráfico
+                           (cobre a legenda do zoom: a faixa vai na 1a linha) */
+#define CUR_H 19
+
+real_t viga_normal_em(real_t x);
+
+static int     cur_col = DG_W/2;     /* coluna na tela (0..DG_W)             */
+static int     cur_seg = 0;          /* trecho de diag_poli sob o cursor     */
+static int     cur_x_tela = -1;      /* x da faixa salva; -1 = nada salvo    */
+static uint8_t cur_faixa[2 + DG_H];  /* gfx_sprite_t 1 x DG_H               */
+
+/* polinômio do trecho (forma de Newton) em t colunas finas a partir de c0 */
+static inline real_t diag_avaliar(const DiagPoli *pp, int q, real_t t) {
+    const real_t *d = pp->d[q], *s = pp->s;
+    return d[0] + (t - s[0]) * (d[1] + (t - s[1]) * (d[2] + (t - s[2]) * d[3]));
+}
+
+/* coluna fina sob o cursor e o trecho que a contém */
+static const DiagPoli *cur_trecho(int *pf) {
+    int f = (diag_off + cur_col) << diag_nivel_zoom();
+    if (f > DG_BASE) f = DG_BASE;
+    if (cur_seg >= diag_npoli) cur_seg = diag_npoli - 1;
+    while (cur_seg < diag_npoli - 1 && f > diag_poli[cur_seg].c1) cur_seg++;
+    while (cur_seg > 0 && f < diag_poli[cur_seg].c0) cur_seg--;
+    *pf = f;
+    return &diag_poli[cur_seg];
+}
+
+/* devolve a faixa antiga, salva a nova e traça o cursor */
+static void cur_desenhar(void) {
+    gfx_sprite_t *fx = (gfx_sprite_t *)cur_faixa;
+    if (cur_x_tela >= 0) {
+        gfx_Sprite_NoClip(fx, cur_x_tela, DG_YTOP);
+        tela_sujar(cur_x_tela, DG_YTOP, 1, DG_H);
+    }
+    cur_x_tela = DG_X0 + cur_col;
+    fx->width = 1;
+    fx->height = DG_H;
+    gfx_GetSprite(fx, cur_x_tela, DG_YTOP);
+    gfx_SetColor(2);
+    gfx_VertLine(cur_x_tela, DG_YTOP, DG_H);
+    tela_sujar(cur_x_tela, DG_YTOP, 1, DG_H);
+}
+
+static void cur_leitura(void) {
+    char buf[STRBUF];
+    int f;
+    const DiagPoli *pp = cur_trecho(&f);
+    real_t t = (real_t)(f - pp->c0);
+    real_t x = L * (real_t)f / (real_t)DG_BASE;
+    real_t V = diag_avaliar(pp, 0, t), M = diag_avaliar(pp, 1, t);
+    TensaoNM tn;
+    char fx[24];
+    diag_faixa_leitura(fx, sizeof fx);
+
+    gfx_SetColor(0);
+    gfx_FillRectangle(0, CUR_Y, 320, CUR_H);
+    gfx_SetTextFGColor(1);
+    sprintf(buf, "x=%.3f %s %s V=%.3f %s", len_from_calc(x), unit_viga_name, fx, V * diag[0].u, diag[0].unit);
+    gfx_PrintStringXY(buf, 8, CUR_Y + 1);
+    if (campo_NM(viga_normal_em(x), M, &tn))
+        sprintf(buf, "M=%.3f %s  sig %.2f/%.2f MPa", M * diag[1].u, diag[1].unit,
+                tn.sig_sup / 1e6, tn.sig_inf / 1e6);
+    else
+        sprintf(buf, "M=%.3f %s", M * diag[1].u, diag[1].unit);
+    gfx_PrintStringXY(buf, 8, CUR_Y + 10);
+    tela_sujar(0, CUR_Y, 320, CUR_H);
+}
+
+/* move o cursor dcol colunas; na borda com zoom desloca a vista.
+   true se a vista mudou (pede redesenho completo) */
+static bool cur_mover(int dcol) {
+    int c = cur_col + dcol;
+    if (c < 0 || c > DG_W) {
+        int antes = diag_off;
+        diag_pan(c < 0 ? -DG_W/8 : DG_W/8);
+        cur_col += antes - diag_off;
+        c = cur_col + dcol;
+        if (c < 0) c = 0;
+        if (c > DG_W) c = DG_W;
+        cur_col = c;
+        if (diag_off != antes) return true;
+    }
+    if (c == cur_col) return false;
+    cur_col = c;
+    cur_desenhar();
+    cur_leitura();
+    return false;
+}
+
+/* ======== ARRASTE DE CARGAS (what-if) ========
+   2nd escolhe uma carga pontual ou momento; as setas a movem uma coluna
+   por vez. Cada passo corrige as reações por delta (O(1)), move só o seu
+   evento na lista ordenada e reajusta só os trechos varridos (DiagDelta);
+   os demais ganham o termo linear. Nada de resolver_reacoes,
+   coletar_eventos ou reamostragem completa a cada passo.
+   É só simulação: ao sair (CLEAR/TRACE) as posições digitadas voltam. */
+
+/* há outro item do modelo em x (além da carga selecionada)? */
+static bool outro_evento_em(real_t x, int sel) {
+    const real_t tol = 1e-9;
+    if (fabs(x) < tol || fabs(x - L) < tol) return true;
+    for (int i = 0; i < n_apoios; i++)   if (fabs(apoios[i].pos - x) < tol) return true;
+    for (int i = 0; i < n_cargas_p; i++) if (i != sel && fabs(cargas_p[i].pos - x) < tol) return true;
+    for (int i = 0; i < n_cargas_d; i++)
+        if (fabs(cargas_d[i].x_ini - x) < tol || fabs(cargas_d[i].x_fim - x) < tol) return true;
+    for (int i = 0; i < n_momentos; i++)
+        if (i + n_cargas_p != sel && fabs(momentos[i].pos - x) < tol) return true;
+    return false;
+}
+
+/* tira a de diag_ev (se nada mais estiver lá) e insere a2 em ordem, O(nev) */
+static void diag_ev_mover(real_t a, real_t a2, bool fica) {
+    const real_t tol = 1e-9;
+    int n = diag_nev;
+    if (!fica) {
+        int k = 0;
+        while (k < n && fabs(diag_ev[k] - a) >= tol) k++;
+        if (k < n) { for (; k < n - 1; k++) diag_ev[k] = diag_ev[k+1]; n--; }
+    }
+    int k = 0;
+    while (k < n && diag_ev[k] < a2 - tol) k++;
+    if ((k >= n || fabs(diag_ev[k] - a2) >= tol) && n < MAX_EVENTS) {
+        for (int m = n; m > k; m--) diag_ev[m] = diag_ev[m-1];
+        diag_ev[k] = a2;
+        n++;
+    }
+    diag_nev = n;
+}
+
+/* move a carga selecionada de dx [m]; false se não saiu do lugar */
+static bool arr_mover(real_t dx) {
+    bool pontual = arr_sel < n_cargas_p;
+    real_t *ppos = pontual ? &cargas_p[arr_sel].pos : &momentos[arr_sel - n_cargas_p].pos;
+    real_t a = *ppos, a2 = a + dx;
+    if (a2 < 0.0) a2 = 0.0;
+    if (a2 > L)   a2 = L;
+    if (a2 == a) return false;
+
+    DiagDelta dl;
+    dl.lo = fmin(a, a2);
+    dl.hi = fmax(a, a2);
+    dl.dM_dir = 0.0;
+    for (int i = 0; i < MAX_APOIOS; i++) dl.dR[i] = dl.dMa[i] = 0.0;
+    if (pontual) {
+        /* mesmas somas de resolver_reacoes, só o termo F*(pos - ref) muda;
+           um momento aplicado não depende da posição -> reações iguais */
+        real_t dFm = cargas_p[arr_sel].F * (a2 - a);
+        dl.dM_dir = dFm;
+        if (n_apoios == 2) {
+            dl.dR[1] = dFm / (apoios[1].pos - apoios[0].pos);
+            dl.dR[0] = -dl.dR[1];
+        } else {
+            dl.dMa[0] = -dFm;
+        }
+        for (int i = 0; i < n_apoios; i++) { apoios[i].Ry += dl.dR[i]; apoios[i].Ma += dl.dMa[i]; }
+    }
+
+    bool fica = outro_evento_em(a, arr_sel);
+    *ppos = a2;
+    diag_ev_mover(a, a2, fica);
+
+    /* a vista segue a carga: se saiu da tela, desloca até ela voltar */
+    int xx = diag_xtela(a2);
+    if (xx < DG_X0)      diag_pan(xx - DG_X0 - DG_W/8);
+    else if (xx > DG_X1) diag_pan(xx - DG_X1 + DG_W/8);
+#ifdef MECSOL_FIXO
+    viga_fx.ok = false;   /* modelo quantizado ficou velho; volta no próximo resolver_reacoes */
+#endif
+    diag_trechos(&dl);
+    diag_desenho(false);
+
+    viga_revisao++;             /* o modelo mudou, mas este cache já está em dia */
+    diag_rev = viga_revisao;
+    return true;
+}
+
+static void arr_guardar(void) {
+    for (int i = 0; i < n_cargas_p; i++) arr_orig[i] = cargas_p[i].pos;
+    for (int i = 0; i < n_momentos; i++) arr_orig[n_cargas_p + i] = momentos[i].pos;
+}
+
+/* fim do arraste: volta às posições digitadas e resolve tudo de novo
+   (zera também a deriva dos deltas nas reações) */
+static void arr_soltar(void) {
+    for (int i = 0; i < n_cargas_p; i++) cargas_p[i].pos = arr_orig[i];
+    for (int i = 0; i < n_momentos; i++) momentos[i].pos = arr_orig[n_cargas_p + i];
+    arr_sel = -1;
+    viga_revisao++;
+    diag_ok = false;
+    diag_montar();
+}
+
+static void arr_leitura(void) {
+    char buf[STRBUF];
+    bool pontual = arr_sel < n_cargas_p;
+    int idx = pontual ? arr_sel : arr_sel - n_cargas_p;
+    real_t xs = pontual ? cargas_p[idx].pos : momentos[idx].pos;
+    const DiagCache *dv = &diag[0], *dm = &diag[1];
+    char fx[24];
+    diag_faixa_leitura(fx, sizeof fx);
+
+    gfx_SetColor(0);
+    gfx_FillRectangle(0, CUR_Y, 320, CUR_H);
+    gfx_SetTextFGColor(1);
+    if (n_apoios == 2)
+        sprintf(buf, "%c%d x=%.3f %s %s R=%.2f/%.2f %s", pontual ? 'P' : 'M', idx + 1,
+                len_from_calc(xs), unit_viga_name, fx, apoios[0].Ry * dv->u, apoios[1].Ry * dv->u, dv->unit);
+    else
+        sprintf(buf, "%c%d x=%.3f %s %s R=%.2f Ma=%.2f", pontual ? 'P' : 'M', idx + 1,
+                len_from_calc(xs), unit_viga_name, fx, apoios[0].Ry * dv->u, apoios[0].Ma * dm->u);
+    gfx_PrintStringXY(buf, 8, CUR_Y + 1);
+
+    /* |M| de pico nas colunas finas e a tensão correspondente */
+    real_t xp = L * (real_t)dm->pico_col / (real_t)DG_BASE;
+    real_t Mp = diag_avaliar(&diag_poli[0], 1, 0.0);
+    for (int j = 0; j < diag_npoli; j++) {
+        const DiagPoli *pp = &diag_poli[j];
+        if (dm->pico_col >= pp->c0 && dm->pico_col <= pp->c1) {
+            Mp = diag_avaliar(pp, 1, (real_t)(dm->pico_col - pp->c0));
+            break;
+        }
+    }
+    TensaoNM tn;
+    if (campo_NM(viga_normal_em(xp), Mp, &tn))
+        sprintf(buf, "|M|=%.2f %s sig %.1f/%.1f MPa", fabs(Mp) * dm->u, dm->unit,
+                tn.sig_sup / 1e6, tn.sig_inf / 1e6);
+    else
+        sprintf(buf, "|M|max=%.3f %s x=%.2f", fabs(Mp) * dm->u, dm->unit, len_from_calc(xp));
+    gfx_PrintStringXY(buf, 8, CUR_Y + 10);
+    tela_sujar(0, CUR_Y, 320, CUR_H);
 }
 
-static void desenhar_legenda(bool isV,
-                             const PtLabel *Lab, int nlab,
-                             double u, const char *unit_title) {
+static void desenhar_legenda(bool isV) {
+    const DiagCache *dc = &diag[isV ? 0 : 1];
+    const PtLabel *Lab = dc->lab;
+    const int nlab = dc->nlab;
+    const real_t u = dc->u;
+    const char *unit_title = dc->unit;
+
     scr_clear();
     gfx_SetTextFGColor(1);
 
@@ -764,8 +1397,8 @@ static void desenhar_legenda(bool isV,
     int y = 24;
     for (int i=0;i<nlab;i++){
         char line[64];
-        double val = Lab[i].val * u;
-        double x_show = len_from_calc(Lab[i].xq);
+        real_t val = Lab[i].val * u;
+        real_t x_show = len_from_calc(Lab[i].xq);
         if (fabs(val) < 1000.0) sprintf(line, "%-3s x=%.2f %s  %.2f %s", Lab[i].tag, x_show, unit_viga_name, val, unit_title);
         else                    sprintf(line, "%-3s x=%.2f %s  %.1f %s", Lab[i].tag, x_show, unit_viga_name, val, unit_title);
         gfx_PrintStringXY(line, 8, y);
@@ -775,7 +1408,7 @@ static void desenhar_legenda(bool isV,
     gfx_SetColor(0);
     gfx_FillRectangle(0,220,320,12);
     gfx_SetTextFGColor(1);
-    gfx_PrintStringXY("LEFT/RIGHT: diagrama   ENTER: alternar", 2, 220);
+    tela_texto("CIMA/BAIXO: diagrama   ENTER: alternar", 2, 220);
 }
 
 static void mostrar_diagramas(void) {
@@ -788,9 +1421,7 @@ static void mostrar_diagramas(void) {
         return;
     }
 
-    double ev[MAX_EVENTS];
-    int nev = coletar_eventos(ev, MAX_EVENTS);
-    if (nev < 2) {
+    if (!diag_montar()) {
         scr_clear();
         gfx_SetTextFGColor(1);
         gfx_PrintStringXY("Sem eventos.", 8, 18);
@@ -798,29 +1429,83 @@ static void mostrar_diagramas(void) {
         return;
     }
 
-    bool isV = true;     /* começa no V */
+    bool isV = true;     /* começa no V, viga inteira */
     bool legend = false; /* começa no diagrama */
+    bool pan = false;    /* último quadro veio de um deslocamento */
+    int  modo = VISTA_LIVRE;
+    int  repete = 0;     /* quadros seguidos com a seta apertada (acelera) */
+    const int n_arr = n_cargas_p + n_momentos;
+    diag_zoom = 1;
+    diag_off = 0;
+    cur_col = DG_W/2;
+    cur_seg = 0;
+    arr_sel = -1;
 
     while (1) {
-        /* escala (amax/u/unidade) e letras para o diagrama atual */
-        double amax,u; const char *unit;
-        compute_scale(isV, ev, nev, &amax, &u, &unit);
-
-        PtLabel Ls[MAX_LABELS];
-        int nlab = build_labels_for(isV, ev, nev, Ls, MAX_LABELS);
-
-        if (legend) desenhar_legenda(isV, Ls, nlab, u, unit);
-        else        desenhar_diagrama_letras(isV, ev, nev, Ls, nlab, amax, u, unit);
+        if (legend) desenhar_legenda(isV);
+        else {
+            desenhar_diagrama_letras(isV, modo, pan);
+            if (modo == VISTA_CURSOR) { cur_x_tela = -1; cur_desenhar(); cur_leitura(); }
+            if (modo == VISTA_ARRASTE) arr_leitura();
+        }
 
-        /* teclado: CLEAR sai; ENTER alterna V/M; setas alternam diagrama/legenda */
-        wait_key_release();
+        /* teclado: CLEAR sai; ENTER alterna V/M; cima/baixo alternam
+           diagrama/legenda; +/- zoom; esquerda/direita deslocam a vista,
+           o cursor (TRACE) ou a carga escolhida (2nd). Segurar repete,
+           sem esperar soltar */
+        if (!pan) wait_key_release();
+        pan = false;
         while (1) {
-            kb_Scan();
+            tela_scan();
             if (kb_On) { gfx_End(); exit(0); }
-            if (kb_Data[6] & kb_Clear) return;
+            if (kb_Data[6] & kb_Clear) {
+                if (modo == VISTA_LIVRE) return;
+                if (modo == VISTA_ARRASTE) arr_soltar();
+                modo = VISTA_LIVRE;
+                break;
+            }
             if (kb_Data[6] & kb_Enter) { isV = !isV; break; }
-            if (kb_Data[7] & (kb_Left | kb_Right)) { legend = !legend; break; }
-            delay(10);
+            if (kb_Data[7] & (kb_Up | kb_Down)) { legend = !legend; break; }
+            if (legend) { entrada_dormir(); continue; }
+            if (kb_Data[1] & kb_Trace) {
+                if (modo == VISTA_ARRASTE) arr_soltar();
+                modo = (modo == VISTA_CURSOR) ? VISTA_LIVRE : VISTA_CURSOR;
+                break;
+            }
+            if ((kb_Data[1] & kb_2nd) && n_arr > 0) {
+                if (modo != VISTA_ARRASTE) arr_guardar();
+                arr_sel = (arr_sel + 1) % n_arr;
+                modo = VISTA_ARRASTE;
+                break;
+            }
+            if ((kb_Data[6] & (kb_Add | kb_Sub)) &&
+                ((kb_Data[6] & kb_Add) ? diag_zoom < DG_ZMAX : diag_zoom > 1)) {
+                /* o cursor fica no mesmo x */
+                real_t xc = L * (real_t)(diag_off + cur_col) / (real_t)(DG_W * diag_zoom);
+                diag_set_zoom((kb_Data[6] & kb_Add) ? diag_zoom * 2 : diag_zoom / 2);
+                cur_col = diag_xtela(xc) - DG_X0;
+                if (cur_col < 0) cur_col = 0;
+                if (cur_col > DG_W) cur_col = DG_W;
+                break;
+            }
+            if (modo == VISTA_CURSOR && (kb_Data[7] & (kb_Left | kb_Right))) {
+                int passo = (repete++ < 12) ? 1 : 4;
+                if (cur_mover((kb_Data[7] & kb_Left) ? -passo : passo)) { pan = true; break; }
+                continue;
+            }
+            if (modo == VISTA_ARRASTE && (kb_Data[7] & (kb_Left | kb_Right))) {
+                int passo = (repete++ < 12) ? 1 : 4;
+                real_t dx = L * (real_t)passo / (real_t)(DG_W * diag_zoom);
+                if (arr_mover((kb_Data[7] & kb_Left) ? -dx : dx)) { pan = true; break; }
+                continue;
+            }
+            repete = 0;
+            if (diag_zoom > 1 && (kb_Data[7] & (kb_Left | kb_Right))) {
+                int antes = diag_off;
+                diag_pan((kb_Data[7] & kb_Left) ? -DG_W/8 : DG_W/8);
+                if (diag_off != antes) { pan = true; break; }
+            }
+            entrada_dormir();
         }
     }
 }
@@ -828,13 +1513,17 @@ static void mostrar_diagramas(void) {
 /* ======== ENTRADA DE DADOS ======== */
 static void obter_dados(void) {
     char tmp[STRBUF];
+    viga_revisao++;
+#ifdef MECSOL_FIXO
+    viga_fx.ok = false;
+#endif
 
     /* 1) comprimento */
     while (1) {
         char msg[STRBUF];
         snprintf(msg, sizeof msg, "1) Comprimento da viga (%s):", unit_viga_name);
-        double t = input_double(msg);
-        double Lcalc = len_to_calc(t);
+        real_t t = input_double(msg);
+        real_t Lcalc = len_to_calc(t);
         if (Lcalc > 0.0) { L = Lcalc; break; }
     }
 
@@ -850,7 +1539,7 @@ static void obter_dados(void) {
 
         while (1) {
             sprintf(tmp, "   Apoio %d - Posicao (%s, 0..%.3f):", i+1, unit_viga_name, len_from_calc(L));
-            double p = len_to_calc(input_double(tmp));
+            real_t p = len_to_calc(input_double(tmp));
             if (p >= 0.0 && p <= L) { apoios[i].pos = p; break; }
         }
         apoios[i].Ry = 0.0; apoios[i].Ma = 0.0;
@@ -890,13 +1579,24 @@ static void obter_dados(void) {
         momentos[i].val = input_double(tmp);
     }
 
-    /* 10/11) pontos de interesse */
-    n_pontos = input_int("10) N de pontos p/ calculo (0..20):");
+    /* 10/11) cargas axiais (reação axial no apoio 1) */
+    n_cargas_n = input_int("10) N de cargas axiais (0..4):");
+    if (n_cargas_n > MAX_CARGAS_N) n_cargas_n = MAX_CARGAS_N;
+    if (n_cargas_n < 0) n_cargas_n = 0;
+    for (int i=0;i<n_cargas_n;i++) {
+        sprintf(tmp, "11) Carga axial %d - Posicao (%s):", i+1, unit_viga_name);
+        cargas_n[i].pos = len_to_calc(input_double(tmp));
+        sprintf(tmp, "   Carga axial %d - Forca (N, >0 p/ +x):", i+1);
+        cargas_n[i].F = input_double(tmp);
+    }
+
+    /* 12/13) pontos de interesse */
+    n_pontos = input_int("12) N de pontos p/ calculo (0..20):");
     if (n_pontos > MAX_PONTOS) n_pontos = MAX_PONTOS;
     for (int i=0;i<n_pontos;i++) {
-        sprintf(tmp, "11) Ponto %d - Posicao (%s, 0..%.3f):", i+1, unit_viga_name, len_from_calc(L));
+        sprintf(tmp, "13) Ponto %d - Posicao (%s, 0..%.3f):", i+1, unit_viga_name, len_from_calc(L));
         while (1) {
-            double px = len_to_calc(input_double(tmp));
+            real_t px = len_to_calc(input_double(tmp));
             if (px >= 0.0 && px <= L) { pontos[i] = px; break; }
         }
     }
@@ -913,18 +1613,18 @@ const char *viga_get_unit_name(void) {
     return unit_viga_name;
 }
 
-double viga_get_unit_factor(void) {
+real_t viga_get_unit_factor(void) {
     return unit_viga;
 }
 
 /* retorna comprimento da viga (m) */
-double viga_get_length(void) {
+real_t viga_get_length(void) {
     return L;
 }
 
 /* momento fletor em um ponto x (m). Se nao conseguir resolver reacoes, retorna 0 */
-double viga_momento_em(double x) {
-    double V, M;
+real_t viga_momento_em(real_t x) {
+    real_t V, M;
 
     if (!resolver_reacoes()) return 0.0;
     if (L <= 0.0) return 0.0;
@@ -936,52 +1636,412 @@ double viga_momento_em(double x) {
     return M;
 }
 
-/* procura M de maior modulo ao longo da viga.
+/* M máximo e mínimo (com sinal) em [x0, x1], exatos.
+   Entre eventos V(x) é no máximo quadrático (carga distribuída linear):
+   ajusta a parábola por 3 amostras e testa as raízes de V dentro do
+   trecho, além das bordas dos dois lados de cada evento (saltos de M
+   por momento aplicado). */
+bool viga_momento_extremos_em(real_t x0, real_t x1,
+                              real_t *pMmax, real_t *pxmax, real_t *pMmin, real_t *pxmin) {
+    const real_t EPS = 1e-6 * L;   /* limites laterais nos eventos (double do eZ80 tem ~7 dígitos) */
+    real_t V, M;
+    real_t Mmax = -1e30, Mmin = 1e30, xmax = 0.0, xmin = 0.0;
+
+    if (!resolver_reacoes() || L <= 0.0) return false;
+    if (caso_ok && x0 <= 0.0 && x1 >= L) {
+        beam_M_extremos(&caso, &Mmax, &xmax, &Mmin, &xmin);
+        if (pMmax) *pMmax = Mmax;
+        if (pxmax) *pxmax = caso_x(xmax);
+        if (pMmin) *pMmin = Mmin;
+        if (pxmin) *pxmin = caso_x(xmin);
+        return true;
+    }
+    if (x0 < 0.0) x0 = 0.0;
+    if (x1 > L)   x1 = L;
+    real_t todos[MAX_EVENTS], ev[MAX_EVENTS + 2];
+    int nt = coletar_eventos(todos, MAX_EVENTS), nev = 0;
+    ev[nev++] = x0;
+    for (int i = 0; i < nt; ++i)
+        if (todos[i] > x0 + EPS && todos[i] < x1 - EPS) ev[nev++] = todos[i];
+    ev[nev++] = x1;
+
+    for (int i = 0; i < nev-1; ++i) {
+        real_t a = ev[i], b = ev[i+1];
+        if (b - a <= 2.0*EPS) continue;
+        real_t cand[4];
+        int nc = 0;
+        cand[nc++] = a + EPS;
+        cand[nc++] = b - EPS;
+
+        /* V = c0 + c1*t + c2*t^2, t = x - meio */
+        real_t meio = 0.5 * (a + b), hh = 0.5 * (b - a) - EPS;
+        real_t Vn, V0, Vp;
+        calcular_forcas_internas_em(meio - hh, &Vn, &M);
+        calcular_forcas_internas_em(meio,      &V0, &M);
+        calcular_forcas_internas_em(meio + hh, &Vp, &M);
+        real_t c0 = V0, c1 = (Vp - Vn) / (2.0*hh), c2 = (Vp + Vn - 2.0*V0) / (2.0*hh*hh);
+        real_t esc = fabs(Vn) + fabs(V0) + fabs(Vp) + 1e-12;
+        if (fabs(c2) * hh*hh > 1e-9 * esc) {
+            real_t disc = c1*c1 - 4.0*c2*c0;
+            if (disc >= 0.0) {
+                real_t r = sqrt(disc);
+                cand[nc++] = meio + (-c1 + r) / (2.0*c2);
+                cand[nc++] = meio + (-c1 - r) / (2.0*c2);
+            }
+        } else if (fabs(c1) * hh > 1e-9 * esc) {
+            cand[nc++] = meio - c0 / c1;
+        }
+
+        for (int k = 0; k < nc; ++k) {
+            real_t x = cand[k];
+            if (x < a + EPS || x > b - EPS) continue;
+            calcular_forcas_internas_em(x, &V, &M);
+            /* bordas reportam o evento, não o x deslocado (dM/dx = V) */
+            real_t xr = (k == 0) ? a : (k == 1) ? b : x;
+            M += V * (xr - x);
+            if (M > Mmax) { Mmax = M; xmax = xr; }
+            if (M < Mmin) { Mmin = M; xmin = xr; }
+        }
+    }
+    if (Mmax < Mmin) return false;
+
+    if (pMmax) *pMmax = Mmax;
+    if (pxmax) *pxmax = xmax;
+    if (pMmin) *pMmin = Mmin;
+    if (pxmin) *pxmin = xmin;
+    return true;
+}
+
+/* força normal N(x) [N], tração > 0. O apoio 1 (fixo/engaste) segura a
+   resultante axial; N(x) = -(forças em +x à esquerda do corte). */
+real_t viga_normal_em(real_t x) {
+    real_t soma = 0.0, esq = 0.0;
+    if (n_apoios <= 0) return 0.0;
+    for (int i=0;i<n_cargas_n;i++) {
+        soma += cargas_n[i].F;
+        if (cargas_n[i].pos < x) esq += cargas_n[i].F;
+    }
+    if (apoios[0].pos < x) esq -= soma;   /* reação axial = -soma */
+    return -esq;
+}
+
+/* trechos de N constante: 0, posições das cargas axiais e do apoio 1, L.
+   Ordenados e sem repetição; devolve a quantidade de pontos. */
+int viga_normal_trechos(real_t *xs, int maxn) {
+    int n = 0;
+    if (L <= 0.0 || maxn < 2) return 0;
+    xs[n++] = 0.0;
+    if (n_cargas_n > 0 && n_apoios > 0 && n < maxn) xs[n++] = apoios[0].pos;
+    for (int i=0;i<n_cargas_n && n<maxn;i++) xs[n++] = cargas_n[i].pos;
+    if (n < maxn) xs[n++] = L; else xs[n-1] = L;
+
+    for (int i=1;i<n;i++) {
+        real_t v = xs[i]; int j = i-1;
+        while (j>=0 && xs[j] > v) { xs[j+1] = xs[j]; j--; }
+        xs[j+1] = v;
+    }
+    int m = 0;
+    for (int i=0;i<n;i++) {
+        if (xs[i] < 0.0 || xs[i] > L) continue;
+        if (m==0 || fabs(xs[i] - xs[m-1]) > 1e-9) xs[m++] = xs[i];
+    }
+    return m;
+}
+
+/* existe alguma carga axial? */
+int viga_tem_normal(void) {
+    return n_cargas_n > 0;
+}
+
+/* extremos de M na viga inteira */
+bool viga_momento_extremos(real_t *pMmax, real_t *pxmax, real_t *pMmin, real_t *pxmin) {
+    return viga_momento_extremos_em(0.0, L, pMmax, pxmax, pMmin, pxmin);
+}
+
+/* procura M de maior modulo ao longo da viga (exato, via extremos).
    Retorna M (com sinal). Se px_max != NULL, grava ali a coordenada correspondente. */
-double viga_momento_max_abs(double *px_max) {
-    double V, M;
+real_t viga_momento_max_abs(real_t *px_max) {
+    real_t Mmax, xmax, Mmin, xmin;
 
-    if (!resolver_reacoes()) {
+    if (!viga_momento_extremos(&Mmax, &xmax, &Mmin, &xmin)) {
         if (px_max) *px_max = 0.0;
         return 0.0;
     }
-    if (L <= 0.0) {
-        if (px_max) *px_max = 0.0;
-        return 0.0;
+    if (fabs(Mmin) > fabs(Mmax)) {
+        if (px_max) *px_max = xmin;
+        return Mmin;
     }
+    if (px_max) *px_max = xmax;
+    return Mmax;
+}
 
-    double ev[MAX_EVENTS];
-    int nev = coletar_eventos(ev, MAX_EVENTS);
-    if (nev < 2) {
-        if (px_max) *px_max = 0.0;
-        return 0.0;
+/* M em vários pontos: reações resolvidas uma vez só (grade de tensões) */
+int viga_momento_lote(const real_t *xs, real_t *Ms, int n) {
+    real_t V;
+    if (!resolver_reacoes() || L <= 0.0) return 0;
+    for (int i = 0; i < n; i++) {
+        real_t x = xs[i];
+        if (x < 0.0) x = 0.0;
+        if (x > L)   x = L;
+        calcular_forcas_internas_em(x, &V, &Ms[i]);
     }
+    return n;
+}
 
-    const int SAMP = 16;
-    double bestM  = 0.0;
-    double maxAbs = 0.0;
-    double bestX  = 0.0;
+/* intensidade total das cargas distribuídas em x (N/m, >0 p/ baixo) */
+static real_t carga_dist_em(real_t x) {
+    real_t q = 0.0;
+    for (int i=0;i<n_cargas_d;i++) {
+        real_t a = cargas_d[i].x_ini, b = cargas_d[i].x_fim;
+        if (x < a || x > b || fabs(b - a) < 1e-12) continue;
+        q += cargas_d[i].f_ini + (cargas_d[i].f_fim - cargas_d[i].f_ini) * (x - a) / (b - a);
+    }
+    return q;
+}
+
+/* procura V de maior modulo ao longo da viga (exato).
+   Entre eventos V e no maximo quadratico: extremos nas bordas de cada trecho
+   (dos dois lados do salto) ou onde q(x) = -dV/dx zera dentro do trecho. */
+real_t viga_cortante_max_abs(real_t *px_max) {
+    const real_t EPS = 1e-6 * L;   /* limites laterais nos eventos, relativo ao vão (viga em mm) */
+    real_t V, M;
+
+    if (px_max) *px_max = 0.0;
+    if (!resolver_reacoes() || L <= 0.0) return 0.0;
+    if (caso_ok) {
+        real_t xb, Vc = beam_V_max(&caso, &xb);
+        if (px_max) *px_max = caso_x(xb);
+        return caso_espelho ? -Vc : Vc;   /* espelhar inverte o sinal de V */
+    }
+
+    real_t ev[MAX_EVENTS];
+    int nev = coletar_eventos(ev, MAX_EVENTS);
+    if (nev < 2) return 0.0;
 
+    real_t bestV = 0.0, bestX = 0.0;
     for (int i = 0; i < nev-1; ++i) {
-        double a = ev[i];
-        double b = ev[i+1];
-        for (int k = 0; k <= SAMP; ++k) {
-            double x = a + (b - a) * (double)k / (double)SAMP;
-            if (x < 0.0) x = 0.0;
-            if (x > L)   x = L;
+        real_t a = ev[i], b = ev[i+1];
+        if (b - a <= 2.0*EPS) continue;
+        real_t cand[3];
+        int nc = 0;
+        cand[nc++] = a + EPS;
+        cand[nc++] = b - EPS;
+        real_t qa = carga_dist_em(a + EPS), qb = carga_dist_em(b - EPS);
+        if ((qa < 0.0 && qb > 0.0) || (qa > 0.0 && qb < 0.0))
+            cand[nc++] = (a + EPS) + (b - a - 2.0*EPS) * qa / (qa - qb);   /* q linear no trecho */
+
+        for (int k = 0; k < nc; ++k) {
+            calcular_forcas_internas_em(cand[k], &V, &M);
+            if (fabs(V) > fabs(bestV)) { bestV = V; bestX = cand[k]; }
+        }
+    }
 
-            calcular_forcas_internas_em(x, &V, &M);
-            double am = fabs(M);
-            if (am > maxAbs) {
-                maxAbs = am;
-                bestM  = M;
-                bestX  = x;
+    if (px_max) *px_max = bestX;
+    return bestV;
+}
+
+/* cortante em um ponto x (m). Se nao conseguir resolver reacoes, retorna 0 */
+real_t viga_cortante_em(real_t x) {
+    real_t V, M;
+
+    if (!resolver_reacoes()) return 0.0;
+    if (L <= 0.0) return 0.0;
+
+    if (x < 0.0) x = 0.0;
+    if (x > L)   x = L;
+
+    calcular_forcas_internas_em(x, &V, &M);
+    return V;
+}
+
+/* Flecha por integracao dupla de M (EI = 1): y'' = M.
+   Integra trecho a trecho (Simpson, exato p/ theta com M cubico) a partir de
+   theta=y=0 em x=0 e corrige com c1 + c2*x pelas condicoes de apoio:
+   biapoiada y(a)=y(b)=0; engastada y(e)=y'(e)=0.
+   Duas passadas para nao guardar a malha (pilha pequena no eZ80).
+   Grava y*EI e theta*EI de maior modulo (com sinal) e suas posicoes. */
+static bool integrar_flecha(real_t *py, real_t *pxy, real_t *pth, real_t *pxth) {
+    const int SUB = 16;
+    real_t V;
+
+    real_t ev[MAX_EVENTS];
+    int nev = coletar_eventos(ev, MAX_EVENTS);
+    if (nev < 2) return false;
+
+    real_t c1 = 0.0, c2 = 0.0;
+    real_t best = 0.0, bestX = 0.0, bestT = 0.0, bestTX = 0.0;
+
+    for (int passo = 0; passo < 2; passo++) {
+        real_t th = 0.0, y = 0.0, M0 = 0.0;
+        real_t ya = 0.0, yb = 0.0, the = 0.0, ye = 0.0;
+        if (passo == 1) {
+            if (fabs(c1) > fabs(best))  { best = c1;  bestX = 0.0; }
+            if (fabs(c2) > fabs(bestT)) { bestT = c2; bestTX = 0.0; }
+        }
+
+        for (int i = 0; i < nev; i++) {
+            real_t x = ev[i];
+            if (i > 0) {
+                real_t a = ev[i-1], h = (x - a) / SUB;
+                const real_t e = 1e-6 * L;   /* limites laterais: M salta em apoios/momentos */
+                calcular_forcas_internas_em(a + e, &V, &M0);
+                for (int k = 0; k < SUB && h > 0.0; k++) {
+                    real_t xm = a + (k + 0.5) * h, x1 = a + (k + 1) * h;
+                    real_t Mm, M1;
+                    calcular_forcas_internas_em(xm, &V, &Mm);
+                    calcular_forcas_internas_em(k == SUB-1 ? x1 - e : x1, &V, &M1);
+                    y  += h * th + h*h / 6.0 * (M0 + 2.0*Mm);
+                    th += h / 6.0 * (M0 + 4.0*Mm + M1);
+                    M0 = M1;
+                    if (passo == 1) {
+                        real_t yy = y + c1 + c2 * x1, tt = th + c2;
+                        if (fabs(yy) > fabs(best))  { best = yy;  bestX = x1; }
+                        if (fabs(tt) > fabs(bestT)) { bestT = tt; bestTX = x1; }
+                    }
+                }
+            }
+            /* valores nos apoios (os apoios sao eventos -> caem em nos da malha) */
+            if (n_apoios == 2) {
+                if (fabs(x - apoios[0].pos) < 1e-9) ya = y;
+                if (fabs(x - apoios[1].pos) < 1e-9) yb = y;
+            } else if (fabs(x - apoios[0].pos) < 1e-9) {
+                ye = y; the = th;
+            }
+        }
+
+        if (passo == 0) {
+            if (n_apoios == 2) {
+                real_t pa = apoios[0].pos, pb = apoios[1].pos;
+                c2 = -(yb - ya) / (pb - pa);
+                c1 = -ya - c2 * pa;
+            } else {
+                real_t pe = apoios[0].pos;
+                c2 = -the;
+                c1 = -ye - c2 * pe;
             }
         }
     }
 
-    if (px_max) *px_max = bestX;
-    return bestM;
+    if (py)   *py = best;
+    if (pxy)  *pxy = bestX;
+    if (pth)  *pth = bestT;
+    if (pxth) *pxth = bestTX;
+    return true;
+}
+
+/* y*EI de maior modulo (com sinal, <0 p/ baixo); grava x em *px */
+real_t viga_flecha_max_EI(real_t *px) {
+    real_t y = 0.0, xy = 0.0;
+
+    if (px) *px = 0.0;
+    if (!resolver_reacoes() || L <= 0.0) return 0.0;
+    if (caso_ok) {
+        y = beam_y_max(&caso, &xy);
+        if (px) *px = caso_x(xy);
+        return y;
+    }
+    if (!integrar_flecha(&y, &xy, NULL, NULL)) return 0.0;
+    if (px) *px = xy;
+    return y;
+}
+
+/* rotacao theta*EI de maior modulo (com sinal, anti-horario > 0); x em *px */
+real_t viga_rotacao_max_EI(real_t *px) {
+    real_t th = 0.0, xth = 0.0;
+
+    if (px) *px = 0.0;
+    if (!resolver_reacoes() || L <= 0.0) return 0.0;
+    if (caso_ok) {
+        th = beam_theta_max(&caso, &xth);
+        if (px) *px = caso_x(xth);
+        return caso_espelho ? -th : th;   /* y' troca de sinal com x -> L - x */
+    }
+    if (!integrar_flecha(NULL, NULL, &th, &xth)) return 0.0;
+    if (px) *px = xth;
+    return th;
+}
+
+/* ======== DERIVADAS (números duais) ======== */
+
+int viga_n_cargas_p(void) {
+    return n_cargas_p;
+}
+
+/* mesmas equações de resolver_reacoes, com as cargas pontuais em Dual
+   (P_j e a_j semeados); distribuídas e momentos entram como constantes */
+static bool reacoes_dual(int j, int sP, int sa, Dual *Ry, Dual *Ma) {
+    if (n_apoios <= 0) return false;
+    real_t pos_r = apoios[0].pos;
+    Dual soma_fy = dual_c(0.0), soma_m = dual_c(0.0);
+
+    for (int i=0;i<n_cargas_p;i++) {
+        Dual F = dual_var(cargas_p[i].F,   i == j ? sP : -1);
+        Dual a = dual_var(cargas_p[i].pos, i == j ? sa : -1);
+        soma_fy = dual_add(soma_fy, F);
+        soma_m  = dual_add(soma_m, dual_mul(F, dual_sub(a, dual_c(pos_r))));
+    }
+    for (int i=0;i<n_cargas_d;i++) {
+        real_t x_ini=cargas_d[i].x_ini, Ld=cargas_d[i].x_fim - x_ini;
+        real_t qa=cargas_d[i].f_ini, dq=cargas_d[i].f_fim - qa;
+        real_t F = qa*Ld + 0.5*dq*Ld;
+        soma_fy = dual_add(soma_fy, dual_c(F));
+        soma_m  = dual_add(soma_m, dual_c(F*(x_ini - pos_r) + 0.5*qa*Ld*Ld + dq*Ld*Ld/3.0));
+    }
+    for (int i=0;i<n_momentos;i++) soma_m = dual_add(soma_m, dual_c(momentos[i].val));
+
+    for (int i=0;i<n_apoios;i++) { Ry[i] = dual_c(0.0); Ma[i] = dual_c(0.0); }
+    if (n_apoios == 1 && apoios[0].tipo == 'E') {
+        Ry[0] = soma_fy;
+        Ma[0] = dual_esc(soma_m, -1.0);
+        return true;
+    }
+    if (n_apoios == 2) {
+        real_t vao = apoios[1].pos - pos_r;
+        if (fabs(vao) < 1e-9) return false;
+        Ry[1] = dual_esc(soma_m, 1.0 / vao);
+        Ry[0] = dual_sub(soma_fy, Ry[1]);
+        return true;
+    }
+    return false;
+}
+
+/* M(x) e dM/dP_j, dM/da_j numa passada (mesma soma de
+   calcular_forcas_internas_em). lado = -1/+1 toma o limite à esquerda/
+   direita de x: num evento (engaste, apoio, carga) M salta.
+   Se x está sob a carga j (máximo no bico da carga), a estação anda com
+   ela: x = a_j também é semeado e dM/da_j sai como a derivada do máximo,
+   P(L-2a)/L na biapoiada, e não a parcial com x fixo. */
+bool viga_momento_dual(real_t x, int lado, int j, int slot_P, int slot_a, Dual *pM) {
+    Dual Ry[MAX_APOIOS], Ma[MAX_APOIOS];
+    *pM = dual_c(0.0);
+    if (L <= 0.0 || !reacoes_dual(j, slot_P, slot_a, Ry, Ma)) return false;
+
+    const real_t tol = 1e-6 * L;
+    bool sob_j = (j >= 0 && j < n_cargas_p && slot_a >= 0 && fabs(cargas_p[j].pos - x) <= tol);
+    x += (real_t)lado * tol;
+    if (x < 0.0) x = 0.0;
+    if (x > L)   x = L;
+    Dual xd = dual_var(x, sob_j ? slot_a : -1);
+
+    Dual M = dual_c(0.0);
+    for (int i=0;i<n_apoios;i++) {
+        if (apoios[i].pos < x) {
+            M = dual_add(M, dual_mul(Ry[i], dual_sub(xd, dual_c(apoios[i].pos))));
+            M = dual_add(M, Ma[i]);
+        }
+    }
+    for (int i=0;i<n_cargas_p;i++) {
+        Dual F = dual_var(cargas_p[i].F,   i == j ? slot_P : -1);
+        Dual a = dual_var(cargas_p[i].pos, i == j ? slot_a : -1);
+        if (a.v <= x) M = dual_sub(M, dual_mul(F, dual_sub(xd, a)));
+    }
+
+    real_t Vd, Md;
+    parcela_dist_momentos_em(x, &Vd, &Md);
+    Dual Mdist = dual_c(Md);
+    if (sob_j) Mdist.d[slot_a] = Vd;   /* d(Md)/dx = Vd */
+    *pM = dual_add(M, Mdist);
+    return true;
 }
 
 /* ======== MENU ======== */
@@ -991,15 +2051,15 @@ static char ler_opcao_menu(void) {
 
     scr_clear();
     gfx_SetTextFGColor(1);
-    scr_print_xy("=== MENU VIGA ===", 2, 2);
+    tela_texto("=== MENU VIGA ===", 2, 2);
     char ubuf[32];
     snprintf(ubuf, sizeof ubuf, "Unidade: %s", unit_viga_name);
     scr_print_xy(ubuf, 200, 2);
-    scr_print_xy("1) Calcular Reacoes de Apoio", 2, 18);
-    scr_print_xy("2) Forcas Internas nos Pontos", 2, 30);
-    scr_print_xy("3) Diagramas V e M", 2, 42);
-    scr_print_xy("4) Voltar menu principal", 2, 54);
-    scr_print_xy("5) Unidade de medida", 2, 66);
+    tela_texto("1) Calcular Reacoes de Apoio", 2, 18);
+    tela_texto("2) Forcas Internas nos Pontos", 2, 30);
+    tela_texto("3) Diagramas V e M", 2, 42);
+    tela_texto("4) Voltar menu principal", 2, 54);
+    tela_texto("5) Unidade de medida", 2, 66);
 
     desenhar_viga_menu();  /* viga desenhada abaixo do menu */
 
@@ -1023,7 +2083,7 @@ static void menu_loop(void) {
                 (void)wait_enter_or_clear("ENTER/CLEAR: voltar ao menu");
             } else {
                 for (int i=0;i<n_pontos;i++) {
-                    double V, M; char buf[STRBUF];
+                    real_t V, M; char buf[STRBUF];
                     calcular_forcas_internas_em(pontos[i], &V, &M);
 
                     scr_clear();
@@ -1032,6 +2092,10 @@ static void menu_loop(void) {
                     sprintf(buf, "x = %.3f %s", len_from_calc(pontos[i]), unit_viga_name);                    scr_print_xy(buf, 2, 18);
                     sprintf(buf, "  V = %.3f N", V);                           scr_print_xy(buf, 2, 30);
                     sprintf(buf, "  M = %.3f Nm", M);                          scr_print_xy(buf, 2, 42);
+                    if (n_cargas_n > 0) {
+                        sprintf(buf, "  N = %.3f N (tracao>0)", viga_normal_em(pontos[i]));
+                        scr_print_xy(buf, 2, 54);
+                    }
 
                     if (!wait_enter_or_clear("ENTER: proximo   CLEAR: menu"))
                         break;
@@ -0,0 +1,124 @@
+#!/usr/bin/env python3
+"""Gera src/perfis_tab.h a partir de tools/perfis.csv (catalogo de perfis do MECSOL).
+
+Uso: python3 tools/gen_perfis.py tools/perfis.csv src/perfis_tab.h
+
+As propriedades saem da mesma decomposicao em retangulos usada na calculadora
+(centroid.c / perfis.c), entao o que a tabela mostra bate com "Formato" ao
+carregar o perfil. Tudo em SI (m, m^2, m^3, m^4, kg/m).
+"""
+
+import csv
+import sys
+
+DENSIDADE = {"A": 7850.0, "M": 600.0}
+TIPO_C = {"I": "PERFIL_I", "U": "PERFIL_U", "L": "PERFIL_L", "R": "PERFIL_R"}
+MAT_C = {"A": "MAT_ACO", "M": "MAT_MADEIRA"}
+
+
+def retangulos(tipo, d, bf, tw, tf):
+    """(w, h, x0, y0) com a origem no canto inferior esquerdo (igual perfis.c)."""
+    if tipo == "I":
+        return [(bf, tf, 0.0, 0.0),
+                (tw, d - 2 * tf, (bf - tw) / 2, tf),
+                (bf, tf, 0.0, d - tf)]
+    if tipo == "U":
+        return [(bf, tf, 0.0, 0.0),
+                (tw, d - 2 * tf, 0.0, tf),
+                (bf, tf, 0.0, d - tf)]
+    if tipo == "L":
+        return [(bf, tf, 0.0, 0.0),
+                (tw, d - tf, 0.0, tf)]
+    return [(bf, d, 0.0, 0.0)]
+
+
+def propriedades(rs):
+    A = sum(w * h for w, h, _, _ in rs)
+    Sx = sum(w * h * (x0 + w / 2) for w, h, x0, _ in rs)
+    Sy = sum(w * h * (y0 + h / 2) for w, h, _, y0 in rs)
+    xb, yb = Sx / A, Sy / A
+    Ix = sum(w * h ** 3 / 12 + w * h * (y0 + h / 2 - yb) ** 2 for w, h, _, y0 in rs)
+    Iy = sum(h * w ** 3 / 12 + w * h * (x0 + w / 2 - xb) ** 2 for w, h, x0, _ in rs)
+    ymin = min(y0 for _, _, _, y0 in rs)
+    ymax = max(y0 + h for _, h, _, y0 in rs)
+    S = min(Ix / (ymax - yb), Ix / (yb - ymin))
+
+    # perfil de larguras b(y) (retangulos nao se sobrepoem) -> LNP e Z
+    ys = sorted({y for _, h, _, y0 in rs for y in (y0, y0 + h)})
+    faixas = []
+    for a, b in zip(ys, ys[1:]):
+        larg = sum(w for w, h, _, y0 in rs if y0 <= a and y0 + h >= b)
+        faixas.append((a, b, larg))
+    metade, acum, yp = A / 2, 0.0, ymin
+    for a, b, larg in faixas:
+        dA = larg * (b - a)
+        if acum + dA >= metade:
+            yp = a + (metade - acum) / larg
+            break
+        acum += dA
+    Z = 0.0
+    for a, b, larg in faixas:
+        for lo, hi in ((a, min(b, yp)), (max(a, yp), b)):
+            if hi > lo:
+                Z += larg * (hi - lo) * abs((lo + hi) / 2 - yp)
+
+    # fator de cisalhamento k = max Q/(Ix*b): tau_max = V*k  (Q parabolico por faixa)
+    k = 0.0
+    for i, (a, b, larg) in enumerate(faixas):
+        if larg <= 0:
+            continue
+        for y in (a, b, yb):
+            if not (a <= y <= b):
+                continue
+            Q = 0.0
+            for a2, b2, l2 in faixas:
+                hi = min(b2, y)
+                if hi > a2:
+                    Q += l2 * (hi - a2) * (yb - (a2 + hi) / 2)
+            k = max(k, abs(Q) / (Ix * larg))
+    return A, Ix, Iy, S, Z, k
+
+
+def main():
+    entrada, saida = sys.argv[1], sys.argv[2]
+    linhas = []
+    with open(entrada, newline="") as f:
+        for row in csv.reader(l for l in f if l.strip() and not l.startswith("#")):
+            nome, tipo, mat = row[0].strip(), row[1].strip(), row[2].strip()
+            d, bf, tw, tf = (float(v) / 1000.0 for v in row[3:7])
+            A, Ix, Iy, S, Z, k = propriedades(retangulos(tipo, d, bf, tw, tf))
+            linhas.append(dict(nome=nome, tipo=tipo, mat=mat, d=d, bf=bf, tw=tw, tf=tf,
+                               A=A, Ix=Ix, Iy=Iy, S=S, Z=Z, k=k,
+                               massa=A * DENSIDADE[mat]))
+
+    linhas.sort(key=lambda p: p["nome"])           # tabela em ordem de nome
+    por_S = sorted(range(len(linhas)), key=lambda i: (linhas[i]["S"], i))
+    por_peso = sorted(range(len(linhas)), key=lambda i: (linhas[i]["massa"], i))
+    assert len(linhas) < 256, "indices sao uint8_t"
+
+    def f(v):
+        return "%.6ef" % v
+
+    with open(saida, "w") as out:
+        out.write("/*  src/perfis_tab.h\n")
+        out.write("    GERADO por tools/gen_perfis.py a partir de tools/perfis.csv - nao editar.\n")
+        out.write("    Incluido apenas por perfis.c.\n*/\n\n")
+        out.write("#define N_PERFIS %d\n\n" % len(linhas))
+        out.write("/* ordem alfabetica (busca binaria por nome) */\n")
+        out.write("static const Perfil PERFIS[N_PERFIS] = {\n")
+        for p in linhas:
+            out.write('    {"%s", %s, %s, %s, %s, %s, %s, %s, %s, %s, %s, %s, %s, %s},\n' % (
+                p["nome"], TIPO_C[p["tipo"]], MAT_C[p["mat"]],
+                f(p["d"]), f(p["bf"]), f(p["tw"]), f(p["tf"]),
+                f(p["A"]), f(p["Ix"]), f(p["Iy"]), f(p["S"]), f(p["Z"]), f(p["k"]),
+                f(p["massa"])))
+        out.write("};\n\n")
+        for nome, idx in (("IDX_S", por_S), ("IDX_PESO", por_peso)):
+            out.write("static const uint8_t %s[N_PERFIS] = {" % nome)
+            for j, i in enumerate(idx):
+                out.write(("\n    " if j % 16 == 0 else " ") + "%d," % i)
+            out.write("\n};\n\n")
+
+
+if __name__ == "__main__":
+    main()